@@ -13,7 +13,13 @@ public class DolbyIO : ModuleRules
         bEnableExceptions = true;
 
         PublicDependencyModuleNames.AddRange(
-            new string[] { "Core", "CoreUObject", "Engine", "HTTP", "Json", "Projects", "RenderCore", "RHI" });
+            new string[] { "Core", "CoreUObject", "Engine", "HTTP", "Json", "Projects", "RenderCore", "RHI", "TraceLog" });
+
+        // Development tools: an in-process stand-in for the Comms SDK (DolbyIO.Fake.* console commands) and
+        // benchmarks built on top of it (DolbyIO.Benchmark.* console commands).
+        bool bWithDevTools = Target.Configuration != UnrealTargetConfiguration.Shipping;
+        PrivateDefinitions.Add("DOLBYIO_WITH_FAKE_BACKEND=" + (bWithDevTools ? "1" : "0"));
+        PrivateDefinitions.Add("DOLBYIO_WITH_BENCHMARKS=" + (bWithDevTools ? "1" : "0"));
 
         string ReleaseDir = "sdk-release";
         if (Target.Platform == UnrealTargetPlatform.Linux)
@@ -0,0 +1,212 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Audio/DolbyIOAudioLevels.h"
+
+#include "Utils/DolbyIOIDTable.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "HAL/IConsoleManager.h"
+
+namespace DolbyIO
+{
+	using namespace dolbyio::comms;
+
+	namespace
+	{
+		TAutoConsoleVariable<float> CVarSmoothingWindowMs{
+		    TEXT("DolbyIO.AudioLevels.SmoothingWindowMs"), 1000.0f,
+		    TEXT("Duration over which the smoothed audio level of a participant is computed.")};
+
+		TAutoConsoleVariable<float> CVarPeakHoldMs{TEXT("DolbyIO.AudioLevels.PeakHoldMs"), 1500.0f,
+		                                           TEXT("Duration for which the peak audio level is held.")};
+
+		TAutoConsoleVariable<float> CVarSpeakingThreshold{
+		    TEXT("DolbyIO.AudioLevels.SpeakingThreshold"), 0.05f,
+		    TEXT("Audio level at or above which a participant is considered to be speaking.")};
+	}
+
+	FAudioLevels::FStats FAudioLevels::FHistory::Add(float Level, double Time, double SmoothingWindow,
+	                                                 double PeakHold, float SpeakingThreshold)
+	{
+		if (End - Oldest == Capacity)
+		{
+			RemoveOldest();
+		}
+		Levels[End % Capacity] = Level;
+		Times[End % Capacity] = Time;
+		++End;
+		SumOfSquares += Level * Level;
+
+		while (End - OldestSmoothed > 1 && Time - Times[OldestSmoothed % Capacity] > SmoothingWindow)
+		{
+			const float Evicted = Levels[OldestSmoothed++ % Capacity];
+			SumOfSquares -= Evicted * Evicted;
+		}
+		const double KeptWindow = FMath::Max(SmoothingWindow, PeakHold);
+		while (Oldest < OldestSmoothed && Time - Times[Oldest % Capacity] > KeptWindow)
+		{
+			++Oldest;
+		}
+
+		if (Level >= Peak)
+		{
+			Peak = Level;
+			PeakTime = Time;
+		}
+		else if (Time - PeakTime > PeakHold)
+		{
+			UpdatePeak(Time, PeakHold);
+		}
+
+		if (Level < SpeakingThreshold)
+		{
+			SpeakingSince = 0.0;
+		}
+		else if (SpeakingSince == 0.0)
+		{
+			SpeakingSince = Time;
+		}
+
+		const uint64 NumSmoothed = End - OldestSmoothed;
+		return {static_cast<float>(FMath::Sqrt(FMath::Max(SumOfSquares, 0.0) / NumSmoothed)), Peak, SpeakingSince};
+	}
+
+	void FAudioLevels::FHistory::RemoveOldest()
+	{
+		if (Oldest == OldestSmoothed)
+		{
+			const float Evicted = Levels[OldestSmoothed++ % Capacity];
+			SumOfSquares -= Evicted * Evicted;
+		}
+		++Oldest;
+	}
+
+	void FAudioLevels::FHistory::UpdatePeak(double Time, double PeakHold)
+	{
+		Peak = 0.0f;
+		PeakTime = Time;
+		for (uint64 i = Oldest; i < End; ++i)
+		{
+			const uint64 Slot = i % Capacity;
+			if (Time - Times[Slot] <= PeakHold && Levels[Slot] >= Peak)
+			{
+				Peak = Levels[Slot];
+				PeakTime = Times[Slot];
+			}
+		}
+	}
+
+	void FAudioLevels::Update(const std::vector<audio_level>& Levels)
+	{
+		DLB_TRACE_CPU_SCOPE(AudioLevels_Update);
+
+		const double Now = FPlatformTime::Seconds();
+		const double SmoothingWindow = CVarSmoothingWindowMs.GetValueOnAnyThread() / 1000.0;
+		const double PeakHold = CVarPeakHoldMs.GetValueOnAnyThread() / 1000.0;
+		const float SpeakingThreshold = CVarSpeakingThreshold.GetValueOnAnyThread();
+
+		FScopeLock Lock{&WriteLock};
+		// Only this function and Reset touch the back buffer and the histories, and both hold the write lock
+		FBuffer& Back = Buffers[1 - Front];
+		for (FIDHandle ParticipantID : Back.Participants)
+		{
+			Back.Levels[ParticipantID] = 0.0f;
+		}
+		Back.Participants.Reset();
+
+		for (const audio_level& Level : Levels)
+		{
+			const FIDHandle ParticipantID = FIDTable::Intern(Level.participant_id);
+			if (static_cast<int>(ParticipantID) >= Back.Levels.Num())
+			{
+				Back.Levels.SetNumZeroed(ParticipantID + 1);
+			}
+			Back.Levels[ParticipantID] = Level.level;
+			Back.Participants.Add(ParticipantID);
+
+			if (static_cast<int>(ParticipantID) >= Histories.Num())
+			{
+				Histories.SetNum(ParticipantID + 1);
+			}
+			if (!Histories[ParticipantID])
+			{
+				Histories[ParticipantID] = MakeUnique<FHistory>();
+				TrackedParticipants.Add(ParticipantID);
+			}
+		}
+
+		// Participants missing from the update are silent
+		Back.Stats.SetNum(Histories.Num());
+		for (FIDHandle ParticipantID : TrackedParticipants)
+		{
+			const float Level = Back.Levels.IsValidIndex(ParticipantID) ? Back.Levels[ParticipantID] : 0.0f;
+			Back.Stats[ParticipantID] =
+			    Histories[ParticipantID]->Add(Level, Now, SmoothingWindow, PeakHold, SpeakingThreshold);
+		}
+
+		FScopeLock SwapScope{&SwapLock};
+		Front = 1 - Front;
+	}
+
+	void FAudioLevels::Reset()
+	{
+		FScopeLock Lock{&WriteLock};
+		FScopeLock SwapScope{&SwapLock};
+		for (FBuffer& Buffer : Buffers)
+		{
+			for (FIDHandle ParticipantID : Buffer.Participants)
+			{
+				Buffer.Levels[ParticipantID] = 0.0f;
+			}
+			Buffer.Participants.Reset();
+			Buffer.Stats.Reset();
+		}
+		Histories.Reset();
+		TrackedParticipants.Reset();
+	}
+
+	float FAudioLevels::Get(FIDHandle ParticipantID) const
+	{
+		FScopeLock Lock{&SwapLock};
+		const TArray<float>& Levels = Buffers[Front].Levels;
+		return Levels.IsValidIndex(ParticipantID) ? Levels[ParticipantID] : 0.0f;
+	}
+
+	void FAudioLevels::Get(TArray<FString>& OutActiveSpeakers, TArray<float>& OutAudioLevels) const
+	{
+		FScopeLock Lock{&SwapLock};
+		const FBuffer& Buffer = Buffers[Front];
+		OutActiveSpeakers.SetNum(Buffer.Participants.Num(), false);
+		OutAudioLevels.SetNum(Buffer.Participants.Num(), false);
+		for (int i = 0; i < Buffer.Participants.Num(); ++i)
+		{
+			OutActiveSpeakers[i] = FIDTable::ToFString(Buffer.Participants[i]);
+			OutAudioLevels[i] = Buffer.Levels[Buffer.Participants[i]];
+		}
+	}
+
+	float FAudioLevels::GetSmoothed(FIDHandle ParticipantID) const
+	{
+		FScopeLock Lock{&SwapLock};
+		const TArray<FStats>& Stats = Buffers[Front].Stats;
+		return Stats.IsValidIndex(ParticipantID) ? Stats[ParticipantID].Smoothed : 0.0f;
+	}
+
+	float FAudioLevels::GetPeak(FIDHandle ParticipantID) const
+	{
+		FScopeLock Lock{&SwapLock};
+		const TArray<FStats>& Stats = Buffers[Front].Stats;
+		return Stats.IsValidIndex(ParticipantID) ? Stats[ParticipantID].Peak : 0.0f;
+	}
+
+	bool FAudioLevels::IsSpeakingFor(FIDHandle ParticipantID, float Milliseconds) const
+	{
+		FScopeLock Lock{&SwapLock};
+		const TArray<FStats>& Stats = Buffers[Front].Stats;
+		if (!Stats.IsValidIndex(ParticipantID) || Stats[ParticipantID].SpeakingSince == 0.0)
+		{
+			return false;
+		}
+		return (FPlatformTime::Seconds() - Stats[ParticipantID].SpeakingSince) * 1000.0 >= Milliseconds;
+	}
+}
@@ -0,0 +1,79 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "DolbyIO.h"
+#include "Utils/DolbyIOCppSdk.h"
+
+#include "HAL/CriticalSection.h"
+
+namespace DolbyIO
+{
+	// Latest audio level of each participant, indexed by interned participant ID, together with statistics over the
+	// recent history of levels. Updates are written in place to a back buffer and published by swapping it with the
+	// front buffer, so steady-state updates and reads do not allocate and readers never wait for a whole update to be
+	// written.
+	class FAudioLevels final
+	{
+	public:
+		void Update(const std::vector<dolbyio::comms::audio_level>& Levels);
+		void Reset();
+
+		float Get(FIDHandle ParticipantID) const;
+		// Fills the arrays in the order of the last update, reusing their allocations.
+		void Get(TArray<FString>& OutActiveSpeakers, TArray<float>& OutAudioLevels) const;
+
+		// Root mean square of the levels received during DolbyIO.AudioLevels.SmoothingWindowMs.
+		float GetSmoothed(FIDHandle ParticipantID) const;
+		// Highest level received during DolbyIO.AudioLevels.PeakHoldMs.
+		float GetPeak(FIDHandle ParticipantID) const;
+		// Whether the level has stayed at or above DolbyIO.AudioLevels.SpeakingThreshold for at least the duration.
+		bool IsSpeakingFor(FIDHandle ParticipantID, float Milliseconds) const;
+
+	private:
+		struct FStats
+		{
+			float Smoothed = 0.0f;
+			float Peak = 0.0f;
+			double SpeakingSince = 0.0; // 0 when not speaking
+		};
+
+		struct FBuffer
+		{
+			TArray<float> Levels; // indexed by handle
+			TArray<FIDHandle> Participants;
+			TArray<FStats> Stats; // indexed by handle
+		};
+
+		// Ring of the recent levels of a participant, only accessed by the writer. Samples are addressed by the number
+		// of samples added before them, modulo the capacity.
+		class FHistory
+		{
+		public:
+			FStats Add(float Level, double Time, double SmoothingWindow, double PeakHold, float SpeakingThreshold);
+
+		private:
+			static constexpr uint64 Capacity = 64;
+
+			void RemoveOldest();
+			void UpdatePeak(double Time, double PeakHold);
+
+			float Levels[Capacity];
+			double Times[Capacity];
+			uint64 Oldest = 0;
+			uint64 OldestSmoothed = 0;
+			uint64 End = 0;
+			double SumOfSquares = 0.0; // over [OldestSmoothed, End)
+			float Peak = 0.0f;
+			double PeakTime = 0.0;
+			double SpeakingSince = 0.0;
+		};
+
+		FBuffer Buffers[2];
+		int Front = 0;
+		TArray<TUniquePtr<FHistory>> Histories; // indexed by handle
+		TArray<FIDHandle> TrackedParticipants;
+		FCriticalSection WriteLock;
+		mutable FCriticalSection SwapLock;
+	};
+}
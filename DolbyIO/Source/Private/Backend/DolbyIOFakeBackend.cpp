@@ -0,0 +1,765 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Backend/DolbyIOFakeBackend.h"
+
+#if DOLBYIO_WITH_FAKE_BACKEND
+
+#include "DolbyIO.h"
+
+#include "Utils/DolbyIOBroadcastEvent.h"
+#include "Utils/DolbyIOConnectionTimer.h"
+#include "Utils/DolbyIOConversions.h"
+#include "Utils/DolbyIOCppSdk.h"
+#include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOIDTable.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+#include "Video/DolbyIOVideoSink.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+
+#include <stdexcept>
+
+namespace DolbyIO
+{
+	using namespace dolbyio::comms;
+
+	namespace
+	{
+		TAutoConsoleVariable<float> CVarSessionOpenLatencyMs{TEXT("DolbyIO.Fake.SessionOpenLatencyMs"), 50.0f,
+		                                                     TEXT("Simulated time to open a session.")};
+		TAutoConsoleVariable<float> CVarConferenceCreateLatencyMs{
+		    TEXT("DolbyIO.Fake.ConferenceCreateLatencyMs"), 100.0f, TEXT("Simulated time to create a conference.")};
+		TAutoConsoleVariable<float> CVarJoinLatencyMs{TEXT("DolbyIO.Fake.JoinLatencyMs"), 200.0f,
+		                                              TEXT("Simulated time to join a conference.")};
+		TAutoConsoleVariable<float> CVarConnectFailureRate{TEXT("DolbyIO.Fake.ConnectFailureRate"), 0.0f,
+		                                                   TEXT("Probability [0-1] of each connection stage failing.")};
+		TAutoConsoleVariable<float> CVarFrameDropRate{
+		    TEXT("DolbyIO.Fake.FrameDropRate"), 0.0f,
+		    TEXT("Probability [0-1] of a synthetic video frame being dropped.")};
+		TAutoConsoleVariable<float> CVarAudioLevelsIntervalMs{
+		    TEXT("DolbyIO.Fake.AudioLevelsIntervalMs"), 100.0f,
+		    TEXT("Interval between simulated audio levels events, 0 to disable.")};
+		TAutoConsoleVariable<int> CVarSeed{TEXT("DolbyIO.Fake.Seed"), 0,
+		                                   TEXT("Random seed used for failures, drops and audio levels.")};
+
+		constexpr auto FakeLocalParticipantID = "fake-local";
+		constexpr auto FakeConferenceID = "fake-conference";
+
+		FFakeBackend::FSettings GetSettingsFromCVars()
+		{
+			FFakeBackend::FSettings Ret;
+			Ret.SessionOpenLatencyMs = CVarSessionOpenLatencyMs.GetValueOnGameThread();
+			Ret.ConferenceCreateLatencyMs = CVarConferenceCreateLatencyMs.GetValueOnGameThread();
+			Ret.JoinLatencyMs = CVarJoinLatencyMs.GetValueOnGameThread();
+			Ret.ConnectFailureRate = CVarConnectFailureRate.GetValueOnGameThread();
+			Ret.FrameDropRate = CVarFrameDropRate.GetValueOnGameThread();
+			Ret.AudioLevelsIntervalMs = CVarAudioLevelsIntervalMs.GetValueOnGameThread();
+			Ret.Seed = CVarSeed.GetValueOnGameThread();
+			return Ret;
+		}
+
+		participant_info MakeParticipantInfo(const FString& ParticipantID, const FString& Name,
+		                                     participant_status Status)
+		{
+			participant_info Info{};
+			Info.user_id = ToStdString(ParticipantID);
+			Info.info.name = ToStdString(Name);
+			Info.type = participant_type::user;
+			Info.status = Status;
+			Info.is_sending_audio = true;
+			Info.audible_locally = true;
+			return Info;
+		}
+
+		video_track MakeVideoTrack(const FString& VideoTrackID, const FString& ParticipantID)
+		{
+			video_track Track{};
+			Track.peer_id = ToStdString(ParticipantID);
+			Track.sdp_track_id = ToStdString(VideoTrackID);
+			Track.stream_id = ToStdString(VideoTrackID);
+			Track.is_screenshare = false;
+			return Track;
+		}
+
+		FDolbyIOVideoTrack MakeFDolbyIOVideoTrack(const FString& VideoTrackID, const FString& ParticipantID)
+		{
+			FDolbyIOVideoTrack Ret;
+			Ret.TrackID = VideoTrackID;
+			Ret.ParticipantID = ParticipantID;
+			Ret.bIsScreenshare = false;
+			return Ret;
+		}
+
+		void FillFrame(uint8* Buffer, int Stride, int Height, uint32 FrameNumber)
+		{
+			// horizontal gray bars scrolling down by one row per frame
+			for (int Row = 0; Row < Height; ++Row)
+			{
+				FMemory::Memset(Buffer + Row * Stride, static_cast<uint8>(Row + FrameNumber), Stride);
+			}
+		}
+	}
+
+	void FFakeBackend::Install(UDolbyIOSubsystem& Subsystem)
+	{
+		if (Subsystem.Sdk)
+		{
+			DLB_UE_LOG_BASE(Warning, "Cannot install fake backend - already initialized with the SDK");
+			return;
+		}
+
+		DLB_UE_LOG("Installing fake backend");
+		Subsystem.FakeBackend = MakeShared<FFakeBackend>(Subsystem, GetSettingsFromCVars());
+		BroadcastEventWithNative(Subsystem, Subsystem.OnInitialized, Subsystem.OnInitializedNative);
+	}
+
+	void FFakeBackend::Uninstall(UDolbyIOSubsystem& Subsystem)
+	{
+		if (!Subsystem.FakeBackend)
+		{
+			return;
+		}
+
+		DLB_UE_LOG("Uninstalling fake backend");
+		TArray<FString> VideoTrackIDs;
+		Subsystem.FakeBackend->VideoTracks.GenerateKeyArray(VideoTrackIDs);
+		Subsystem.FakeBackend.Reset(); // stops the worker, nothing is fed to the subsystem from now on
+		Subsystem.ConferenceStatus = conference_status::destroyed;
+
+		// Leaves no fake participants or sinks behind for the SDK
+		Subsystem.EmptyRemoteParticipants();
+		Subsystem.BufferedAddedVideoTracks.Empty();
+		Subsystem.BufferedEnabledVideoTracks.Empty();
+		Subsystem.LocalParticipantID.Reset();
+		Subsystem.ConferenceID.Reset();
+		FScopeLock Lock{&Subsystem.VideoSinksLock};
+		for (const FString& VideoTrackID : VideoTrackIDs)
+		{
+			const FIDHandle TrackID = FIDTable::Find(VideoTrackID);
+			if (std::shared_ptr<FVideoSink>* Sink = Subsystem.VideoSinks.Find(TrackID))
+			{
+				(*Sink)->UnbindAllMaterials();
+				Subsystem.VideoSinks.Remove(TrackID);
+			}
+			Subsystem.ParkedVideoTracks.Remove(TrackID);
+		}
+		TRACE_COUNTER_SET(DolbyIO_VideoTracks, Subsystem.VideoSinks.Num());
+		SET_DWORD_STAT(STAT_DolbyIO_ActiveSinks, Subsystem.VideoSinks.Num());
+	}
+
+	FFakeBackend* FFakeBackend::Get(UDolbyIOSubsystem& Subsystem)
+	{
+		return Subsystem.FakeBackend.Get();
+	}
+
+	FFakeBackend::FFakeBackend(UDolbyIOSubsystem& Subsystem, const FSettings& Settings)
+	    : Subsystem(Subsystem), Settings(Settings), Random(Settings.Seed)
+	{
+		Thread = FRunnableThread::Create(this, TEXT("DolbyIOFakeBackend"));
+	}
+
+	FFakeBackend::~FFakeBackend()
+	{
+		Thread->Kill(true);
+		delete Thread;
+	}
+
+	void FFakeBackend::Connect(const FString& UserName, bool bIsSessionOpen, bool bIsConferenceCreated)
+	{
+		const auto OnFailed = [this](const char* Error)
+		{
+			if (Subsystem.ConferenceStatus == conference_status::creating)
+			{
+				Subsystem.UpdateStatus(conference_status::error);
+			}
+			Subsystem.FailConnect(std::make_exception_ptr(std::runtime_error{Error}));
+		};
+
+		OpenSession(bIsSessionOpen,
+		            [this, UserName, bIsConferenceCreated, OnFailed]
+		            {
+			            Subsystem.ConnectionTimer->Record(FConnectionTimer::EStage::SessionOpen);
+			            Subsystem.UpdateStatus(conference_status::creating);
+			            CreateConference(bIsConferenceCreated,
+			                             [this, UserName]
+			                             {
+				                             Subsystem.ConnectionTimer->Record(
+				                                 FConnectionTimer::EStage::ConferenceCreate);
+				                             Subsystem.UpdateStatus(conference_status::created);
+				                             Subsystem.UpdateStatus(conference_status::joining);
+				                             Join(UserName);
+			                             },
+			                             OnFailed);
+		            },
+		            OnFailed);
+	}
+
+	void FFakeBackend::WarmUp(bool bIsSessionOpen, bool bIsConferenceCreated, TFunction<void()> OnWarmedUp)
+	{
+		const auto OnFailed = [this](const char* Error)
+		{
+			DLB_ERROR_HANDLER(Subsystem.OnWarmUpConnectionError)(std::make_exception_ptr(std::runtime_error{Error}));
+			Subsystem.FinishWarmUp();
+		};
+
+		OpenSession(
+		    bIsSessionOpen, [this, bIsConferenceCreated, OnWarmedUp, OnFailed]
+		    { CreateConference(bIsConferenceCreated, OnWarmedUp, OnFailed); }, OnFailed);
+	}
+
+	void FFakeBackend::OpenSession(bool bIsSessionOpen, TFunction<void()> OnOpened,
+	                               TFunction<void(const char*)> OnFailed)
+	{
+		Schedule(bIsSessionOpen ? 0.0f : Settings.SessionOpenLatencyMs,
+		         [this, bIsSessionOpen, OnOpened = MoveTemp(OnOpened), OnFailed = MoveTemp(OnFailed)]
+		         {
+			         if (!bIsSessionOpen)
+			         {
+				         if (ShouldFail(Settings.ConnectFailureRate))
+				         {
+					         return OnFailed("Simulated session open failure");
+				         }
+				         Subsystem.LocalParticipantID = FakeLocalParticipantID;
+			         }
+			         OnOpened();
+		         });
+	}
+
+	void FFakeBackend::CreateConference(bool bIsConferenceCreated, TFunction<void()> OnCreated,
+	                                    TFunction<void(const char*)> OnFailed)
+	{
+		Schedule(bIsConferenceCreated ? 0.0f : Settings.ConferenceCreateLatencyMs,
+		         [this, bIsConferenceCreated, OnCreated = MoveTemp(OnCreated), OnFailed = MoveTemp(OnFailed)]
+		         {
+			         if (!bIsConferenceCreated)
+			         {
+				         if (ShouldFail(Settings.ConnectFailureRate))
+				         {
+					         return OnFailed("Simulated conference create failure");
+				         }
+				         Subsystem.ConferenceID = FakeConferenceID;
+			         }
+			         OnCreated();
+		         });
+	}
+
+	void FFakeBackend::Join(const FString& UserName)
+	{
+		Schedule(Settings.JoinLatencyMs,
+		         [this, UserName]
+		         {
+			         if (ShouldFail(Settings.ConnectFailureRate))
+			         {
+				         Subsystem.UpdateStatus(conference_status::error);
+				         return Subsystem.FailConnect(
+				             std::make_exception_ptr(std::runtime_error{"Simulated join failure"}));
+			         }
+
+			         local_participant_updated Event{};
+			         Event.participant =
+			             MakeParticipantInfo(FakeLocalParticipantID, UserName, participant_status::on_air);
+			         Subsystem.Handle(Event);
+			         Subsystem.UpdateStatus(conference_status::joined);
+			         AnnounceConference();
+		         });
+	}
+
+	void FFakeBackend::AnnounceConference()
+	{
+		// Only non-empty when rejoining after DropConnection
+		TMap<FString, FString> ParticipantsCopy;
+		TArray<FString> VideoTrackIDs;
+		TArray<FString> VideoTrackParticipantIDs;
+		{
+			FScopeLock ScopeLock{&Lock};
+			ParticipantsCopy = Participants;
+			for (const auto& VideoTrack : VideoTracks)
+			{
+				VideoTrackIDs.Add(VideoTrack.Key);
+				VideoTrackParticipantIDs.Add(VideoTrack.Value.ParticipantID);
+			}
+		}
+
+		for (const auto& Participant : ParticipantsCopy)
+		{
+			remote_participant_added Added{};
+			Added.participant = MakeParticipantInfo(Participant.Key, Participant.Value, participant_status::on_air);
+			Subsystem.Handle(Added);
+		}
+		for (int i = 0; i < VideoTrackIDs.Num(); ++i)
+		{
+			remote_video_track_added Event{};
+			Event.track = MakeVideoTrack(VideoTrackIDs[i], VideoTrackParticipantIDs[i]);
+			Subsystem.Handle(Event);
+			Subsystem.HandleVideoTrackEnabled(MakeFDolbyIOVideoTrack(VideoTrackIDs[i], VideoTrackParticipantIDs[i]));
+		}
+	}
+
+	void FFakeBackend::DropConnection()
+	{
+		Schedule(0.0f,
+		         [this]
+		         {
+			         TArray<FString> VideoTrackIDs;
+			         TArray<FString> VideoTrackParticipantIDs;
+			         {
+				         FScopeLock ScopeLock{&Lock};
+				         for (auto& VideoTrack : VideoTracks)
+				         {
+					         VideoTrackIDs.Add(VideoTrack.Key);
+					         VideoTrackParticipantIDs.Add(VideoTrack.Value.ParticipantID);
+					         VideoTrack.Value.Sink.reset(); // no frames until the track is added again
+				         }
+			         }
+
+			         Subsystem.UpdateStatus(conference_status::error);
+			         for (int i = 0; i < VideoTrackIDs.Num(); ++i)
+			         {
+				         remote_video_track_removed Event{};
+				         Event.track = MakeVideoTrack(VideoTrackIDs[i], VideoTrackParticipantIDs[i]);
+				         Subsystem.Handle(Event);
+			         }
+		         });
+	}
+
+	void FFakeBackend::Disconnect()
+	{
+		Schedule(0.0f,
+		         [this]
+		         {
+			         {
+				         FScopeLock ScopeLock{&Lock};
+				         Participants.Empty();
+				         VideoTracks.Empty();
+			         }
+			         Subsystem.UpdateStatus(conference_status::leaving);
+			         Subsystem.UpdateStatus(conference_status::left);
+		         });
+	}
+
+	bool FFakeBackend::IsConnected() const
+	{
+		return Subsystem.IsConnected();
+	}
+
+	void FFakeBackend::RunOnWorker(TFunction<void()> Command)
+	{
+		Schedule(0.0f, MoveTemp(Command));
+	}
+
+	FString FFakeBackend::AddParticipant(const FString& Name)
+	{
+		FString ParticipantID;
+		{
+			FScopeLock ScopeLock{&Lock};
+			ParticipantID = FString::Printf(TEXT("fake-participant-%u"), NextID++);
+			Participants.Emplace(ParticipantID, Name);
+		}
+
+		Schedule(0.0f,
+		         [this, ParticipantID, Name]
+		         {
+			         remote_participant_added Added{};
+			         Added.participant = MakeParticipantInfo(ParticipantID, Name, participant_status::connecting);
+			         Subsystem.Handle(Added);
+
+			         remote_participant_updated Updated{};
+			         Updated.participant = MakeParticipantInfo(ParticipantID, Name, participant_status::on_air);
+			         Subsystem.Handle(Updated);
+		         });
+		return ParticipantID;
+	}
+
+	void FFakeBackend::RemoveParticipant(const FString& ParticipantID)
+	{
+		FString Name;
+		TArray<FString> ParticipantVideoTrackIDs;
+		{
+			FScopeLock ScopeLock{&Lock};
+			if (!Participants.RemoveAndCopyValue(ParticipantID, Name))
+			{
+				return;
+			}
+			for (const auto& VideoTrack : VideoTracks)
+			{
+				if (VideoTrack.Value.ParticipantID == ParticipantID)
+				{
+					ParticipantVideoTrackIDs.Add(VideoTrack.Key);
+				}
+			}
+		}
+
+		for (const FString& VideoTrackID : ParticipantVideoTrackIDs)
+		{
+			RemoveVideoTrack(VideoTrackID);
+		}
+		Schedule(0.0f,
+		         [this, ParticipantID, Name]
+		         {
+			         remote_participant_updated Event{};
+			         Event.participant = MakeParticipantInfo(ParticipantID, Name, participant_status::left);
+			         Subsystem.Handle(Event);
+		         });
+	}
+
+	void FFakeBackend::ForgetParticipant(const FString& ParticipantID)
+	{
+		FScopeLock ScopeLock{&Lock};
+		Participants.Remove(ParticipantID);
+	}
+
+	void FFakeBackend::UpdateParticipant(const FString& ParticipantID)
+	{
+		FString Name;
+		{
+			FScopeLock ScopeLock{&Lock};
+			const FString* FoundName = Participants.Find(ParticipantID);
+			if (!FoundName)
+			{
+				return;
+			}
+			Name = *FoundName;
+		}
+
+		Schedule(0.0f,
+		         [this, ParticipantID, Name]
+		         {
+			         remote_participant_updated Event{};
+			         Event.participant = MakeParticipantInfo(ParticipantID, Name, participant_status::on_air);
+			         Subsystem.Handle(Event);
+		         });
+	}
+
+	TArray<FString> FFakeBackend::GetParticipantIDs()
+	{
+		FScopeLock ScopeLock{&Lock};
+		TArray<FString> Ret;
+		Participants.GenerateKeyArray(Ret);
+		return Ret;
+	}
+
+	FString FFakeBackend::AddVideoTrack(const FString& ParticipantID, int Width, int Height, float Fps)
+	{
+		FString VideoTrackID;
+		{
+			FScopeLock ScopeLock{&Lock};
+			VideoTrackID = FString::Printf(TEXT("{fake-track-%u}"), NextID++);
+			VideoTracks.Emplace(VideoTrackID, FVideoTrack{ParticipantID, FMath::Max(Width, 1), FMath::Max(Height, 1),
+			                                              1.0 / FMath::Max(Fps, 1.0f), 0.0, 0, nullptr});
+		}
+
+		Schedule(0.0f,
+		         [this, VideoTrackID, ParticipantID]
+		         {
+			         remote_video_track_added Event{};
+			         Event.track = MakeVideoTrack(VideoTrackID, ParticipantID);
+			         Subsystem.Handle(Event);
+			         Subsystem.HandleVideoTrackEnabled(MakeFDolbyIOVideoTrack(VideoTrackID, ParticipantID));
+		         });
+		return VideoTrackID;
+	}
+
+	void FFakeBackend::RemoveVideoTrack(const FString& VideoTrackID)
+	{
+		FVideoTrack VideoTrack;
+		{
+			FScopeLock ScopeLock{&Lock};
+			if (!VideoTracks.RemoveAndCopyValue(VideoTrackID, VideoTrack))
+			{
+				return;
+			}
+		}
+
+		Schedule(0.0f,
+		         [this, VideoTrackID, ParticipantID = VideoTrack.ParticipantID]
+		         {
+			         Subsystem.HandleVideoTrackDisabled(MakeFDolbyIOVideoTrack(VideoTrackID, ParticipantID));
+			         remote_video_track_removed Event{};
+			         Event.track = MakeVideoTrack(VideoTrackID, ParticipantID);
+			         Subsystem.Handle(Event);
+		         });
+	}
+
+	void FFakeBackend::SetVideoSink(const FString& VideoTrackID, std::shared_ptr<FVideoSink> Sink)
+	{
+		FScopeLock ScopeLock{&Lock};
+		if (FVideoTrack* VideoTrack = VideoTracks.Find(VideoTrackID))
+		{
+			VideoTrack->Sink = MoveTemp(Sink);
+		}
+	}
+
+	uint32 FFakeBackend::Run()
+	{
+		while (!bIsStopping)
+		{
+			const double Now = FPlatformTime::Seconds();
+			RunDueCommands(Now);
+			RenderDueFrames(Now);
+			EmitAudioLevelsIfDue(Now);
+			FPlatformProcess::SleepNoStats(0.001f);
+		}
+		return 0;
+	}
+
+	void FFakeBackend::Stop()
+	{
+		bIsStopping = true;
+	}
+
+	void FFakeBackend::Schedule(float DelayMs, TFunction<void()> Command)
+	{
+		FScopeLock ScopeLock{&Lock};
+		Commands.Add(FCommand{FPlatformTime::Seconds() + DelayMs / 1000.0, MoveTemp(Command)});
+	}
+
+	void FFakeBackend::RunDueCommands(double Now)
+	{
+		TArray<FCommand> DueCommands;
+		{
+			FScopeLock ScopeLock{&Lock};
+			// Compacts the commands which are not due yet in one pass, keeping the order in which they were scheduled
+			int NumKept = 0;
+			for (int i = 0; i < Commands.Num(); ++i)
+			{
+				if (Commands[i].Time <= Now)
+				{
+					DueCommands.Add(MoveTemp(Commands[i]));
+				}
+				else
+				{
+					if (i != NumKept)
+					{
+						Commands[NumKept] = MoveTemp(Commands[i]);
+					}
+					++NumKept;
+				}
+			}
+			Commands.SetNum(NumKept, false);
+		}
+
+		for (FCommand& Command : DueCommands)
+		{
+			DLB_TRACE_CPU_SCOPE(FakeBackend_Command);
+			Command.Run();
+		}
+	}
+
+	void FFakeBackend::RenderDueFrames(double Now)
+	{
+		struct FFrame
+		{
+			std::shared_ptr<FVideoSink> Sink;
+			int Width;
+			int Height;
+			uint32 FrameNumber;
+		};
+		TArray<FFrame> Frames;
+		{
+			FScopeLock ScopeLock{&Lock};
+			for (auto& VideoTrack : VideoTracks)
+			{
+				FVideoTrack& Track = VideoTrack.Value;
+				if (Track.Sink && Track.NextFrameTime <= Now)
+				{
+					Track.NextFrameTime = Now + Track.FramePeriod;
+					const uint32 FrameNumber = Track.FrameNumber++;
+					if (!ShouldFail(Settings.FrameDropRate))
+					{
+						Frames.Add(FFrame{Track.Sink, Track.Width, Track.Height, FrameNumber});
+					}
+				}
+			}
+		}
+
+		for (const FFrame& Frame : Frames)
+		{
+			Frame.Sink->HandleSyntheticFrame(Frame.Width, Frame.Height,
+			                                 [&Frame](uint8* Buffer, int Stride)
+			                                 { FillFrame(Buffer, Stride, Frame.Height, Frame.FrameNumber); });
+		}
+	}
+
+	void FFakeBackend::EmitAudioLevelsIfDue(double Now)
+	{
+		if (Settings.AudioLevelsIntervalMs <= 0.0f || NextAudioLevelsTime > Now || !Subsystem.IsConnected())
+		{
+			return;
+		}
+		NextAudioLevelsTime = Now + Settings.AudioLevelsIntervalMs / 1000.0;
+
+		audio_levels Event{};
+		{
+			FScopeLock ScopeLock{&Lock};
+			Event.levels.reserve(Participants.Num());
+			for (const auto& Participant : Participants)
+			{
+				const float Level = Random.FRand();
+				if (Level > 0.05f)
+				{
+					audio_level AudioLevel{};
+					AudioLevel.participant_id = ToStdString(Participant.Key);
+					AudioLevel.level = Level;
+					Event.levels.emplace_back(MoveTemp(AudioLevel));
+				}
+			}
+		}
+		Subsystem.Handle(Event);
+	}
+
+	bool FFakeBackend::ShouldFail(float Rate)
+	{
+		return Rate > 0.0f && Random.FRand() < Rate;
+	}
+
+	namespace
+	{
+		UDolbyIOSubsystem* GetSubsystem(UWorld* World)
+		{
+			if (World)
+			{
+				if (UGameInstance* GameInstance = World->GetGameInstance())
+				{
+					return GameInstance->GetSubsystem<UDolbyIOSubsystem>();
+				}
+			}
+			DLB_UE_LOG_BASE(Warning, "No Dolby.io subsystem in this world");
+			return nullptr;
+		}
+
+		FFakeBackend* GetFakeBackend(UWorld* World)
+		{
+			if (UDolbyIOSubsystem* Subsystem = GetSubsystem(World))
+			{
+				if (FFakeBackend* Ret = FFakeBackend::Get(*Subsystem))
+				{
+					return Ret;
+				}
+				DLB_UE_LOG_BASE(Warning, "Fake backend not installed, use DolbyIO.Fake.Install first");
+			}
+			return nullptr;
+		}
+
+		int GetIntArg(const TArray<FString>& Args, int Index, int Default)
+		{
+			return Args.IsValidIndex(Index) ? FCString::Atoi(*Args[Index]) : Default;
+		}
+
+		FAutoConsoleCommandWithWorldAndArgs InstallCommand{
+		    TEXT("DolbyIO.Fake.Install"), TEXT("Replaces the Comms SDK with an in-process fake backend."),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>&, UWorld* World)
+		        {
+			        if (UDolbyIOSubsystem* Subsystem = GetSubsystem(World))
+			        {
+				        FFakeBackend::Install(*Subsystem);
+			        }
+		        })};
+
+		FAutoConsoleCommandWithWorldAndArgs UninstallCommand{
+		    TEXT("DolbyIO.Fake.Uninstall"), TEXT("Removes the fake backend."),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>&, UWorld* World)
+		        {
+			        if (UDolbyIOSubsystem* Subsystem = GetSubsystem(World))
+			        {
+				        FFakeBackend::Uninstall(*Subsystem);
+			        }
+		        })};
+
+		FAutoConsoleCommandWithWorldAndArgs ConnectCommand{
+		    TEXT("DolbyIO.Fake.Connect"), TEXT("Connects to a fake conference. Arguments: [UserName]"),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>& Args, UWorld* World)
+		        {
+			        if (GetFakeBackend(World))
+			        {
+				        GetSubsystem(World)->Connect("fake", Args.IsValidIndex(0) ? Args[0] : "");
+			        }
+		        })};
+
+		FAutoConsoleCommandWithWorldAndArgs WarmUpCommand{
+		    TEXT("DolbyIO.Fake.WarmUp"),
+		    TEXT("Opens a session and creates the fake conference ahead of DolbyIO.Fake.Connect. "
+		         "Arguments: [UserName]"),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>& Args, UWorld* World)
+		        {
+			        if (GetFakeBackend(World))
+			        {
+				        GetSubsystem(World)->WarmUpConnection("fake", Args.IsValidIndex(0) ? Args[0] : "");
+			        }
+		        })};
+
+		FAutoConsoleCommandWithWorldAndArgs DisconnectCommand{
+		    TEXT("DolbyIO.Fake.Disconnect"), TEXT("Disconnects from the fake conference."),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>&, UWorld* World)
+		        {
+			        if (GetFakeBackend(World))
+			        {
+				        GetSubsystem(World)->Disconnect();
+			        }
+		        })};
+
+		FAutoConsoleCommandWithWorldAndArgs DropConnectionCommand{
+		    TEXT("DolbyIO.Fake.DropConnection"),
+		    TEXT("Simulates losing the connection while keeping the fake conference for a reconnect."),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>&, UWorld* World)
+		        {
+			        if (FFakeBackend* FakeBackend = GetFakeBackend(World))
+			        {
+				        FakeBackend->DropConnection();
+			        }
+		        })};
+
+		FAutoConsoleCommandWithWorldAndArgs AddParticipantsCommand{
+		    TEXT("DolbyIO.Fake.AddParticipants"),
+		    TEXT("Adds remote participants, optionally sending video. Arguments: Count [Width Height Fps]"),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>& Args, UWorld* World)
+		        {
+			        if (FFakeBackend* FakeBackend = GetFakeBackend(World))
+			        {
+				        const int Count = GetIntArg(Args, 0, 1);
+				        const int Width = GetIntArg(Args, 1, 0);
+				        const int Height = GetIntArg(Args, 2, Width * 9 / 16);
+				        const int Fps = GetIntArg(Args, 3, 30);
+				        for (int i = 0; i < Count; ++i)
+				        {
+					        const FString ParticipantID =
+					            FakeBackend->AddParticipant(FString::Printf(TEXT("Fake %d"), i));
+					        if (Width > 0)
+					        {
+						        FakeBackend->AddVideoTrack(ParticipantID, Width, Height, Fps);
+					        }
+				        }
+			        }
+		        })};
+
+		FAutoConsoleCommandWithWorldAndArgs RemoveParticipantsCommand{
+		    TEXT("DolbyIO.Fake.RemoveParticipants"), TEXT("Removes remote participants. Arguments: [Count]"),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>& Args, UWorld* World)
+		        {
+			        if (FFakeBackend* FakeBackend = GetFakeBackend(World))
+			        {
+				        const TArray<FString> ParticipantIDs = FakeBackend->GetParticipantIDs();
+				        const int Count = FMath::Min(GetIntArg(Args, 0, ParticipantIDs.Num()), ParticipantIDs.Num());
+				        for (int i = 0; i < Count; ++i)
+				        {
+					        FakeBackend->RemoveParticipant(ParticipantIDs[i]);
+				        }
+			        }
+		        })};
+	}
+}
+
+#endif
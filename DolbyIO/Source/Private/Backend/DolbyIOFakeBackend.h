@@ -0,0 +1,121 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#if DOLBYIO_WITH_FAKE_BACKEND
+
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "Math/RandomStream.h"
+
+#include <atomic>
+#include <memory>
+
+class FRunnableThread;
+class UDolbyIOSubsystem;
+
+namespace DolbyIO
+{
+	class FVideoSink;
+
+	// In-process stand-in for the Comms SDK. Once installed, the subsystem does not talk to the SDK at all: connecting,
+	// participants, video tracks and audio levels are scripted here and fed to the subsystem's event handlers from a
+	// worker thread, the same way the SDK would, so the plugin's own logic can run headless and offline.
+	class FFakeBackend final : public FRunnable
+	{
+	public:
+		struct FSettings
+		{
+			float SessionOpenLatencyMs;
+			float ConferenceCreateLatencyMs;
+			float JoinLatencyMs;
+			float ConnectFailureRate;
+			float FrameDropRate;
+			float AudioLevelsIntervalMs;
+			int Seed;
+		};
+
+		static void Install(UDolbyIOSubsystem& Subsystem);
+		static void Uninstall(UDolbyIOSubsystem& Subsystem);
+		static FFakeBackend* Get(UDolbyIOSubsystem& Subsystem);
+
+		FFakeBackend(UDolbyIOSubsystem& Subsystem, const FSettings& Settings);
+		~FFakeBackend();
+
+		// Stages which were completed ahead of time by WarmUp are skipped.
+		void Connect(const FString& UserName, bool bIsSessionOpen = false, bool bIsConferenceCreated = false);
+		void WarmUp(bool bIsSessionOpen, bool bIsConferenceCreated, TFunction<void()> OnWarmedUp);
+		void Disconnect();
+		void DropConnection();
+		bool IsConnected() const;
+
+		// Runs the command on the worker thread after everything scheduled so far.
+		void RunOnWorker(TFunction<void()> Command);
+
+		FString AddParticipant(const FString& Name);
+		void RemoveParticipant(const FString& ParticipantID);
+		// Removes the participant without telling the subsystem, as if it left while the connection was lost.
+		void ForgetParticipant(const FString& ParticipantID);
+		// Announces the participant's unchanged on-air status again, like the SDK does for other property changes.
+		void UpdateParticipant(const FString& ParticipantID);
+		TArray<FString> GetParticipantIDs();
+
+		FString AddVideoTrack(const FString& ParticipantID, int Width, int Height, float Fps);
+		void RemoveVideoTrack(const FString& VideoTrackID);
+		void SetVideoSink(const FString& VideoTrackID, std::shared_ptr<FVideoSink> Sink);
+
+	private:
+		uint32 Run() override;
+		void Stop() override;
+
+		void Schedule(float DelayMs, TFunction<void()> Command);
+		void OpenSession(bool bIsSessionOpen, TFunction<void()> OnOpened, TFunction<void(const char*)> OnFailed);
+		void CreateConference(bool bIsConferenceCreated, TFunction<void()> OnCreated,
+		                      TFunction<void(const char*)> OnFailed);
+		void Join(const FString& UserName);
+		void AnnounceConference();
+		void RunDueCommands(double Now);
+		void RenderDueFrames(double Now);
+		void EmitAudioLevelsIfDue(double Now);
+		bool ShouldFail(float Rate);
+
+		UDolbyIOSubsystem& GetSubsystem()
+		{
+			return Subsystem;
+		}
+
+		struct FCommand
+		{
+			double Time;
+			TFunction<void()> Run;
+		};
+
+		struct FVideoTrack
+		{
+			FString ParticipantID;
+			int Width;
+			int Height;
+			double FramePeriod;
+			double NextFrameTime;
+			uint32 FrameNumber;
+			std::shared_ptr<FVideoSink> Sink;
+		};
+
+		UDolbyIOSubsystem& Subsystem;
+		const FSettings Settings;
+		FRandomStream Random;
+
+		TArray<FCommand> Commands;
+		TMap<FString, FString> Participants; // ID -> name
+		TMap<FString, FVideoTrack> VideoTracks;
+		FCriticalSection Lock;
+
+		double NextAudioLevelsTime = 0.0;
+		uint32 NextID = 1;
+
+		FRunnableThread* Thread = nullptr;
+		std::atomic<bool> bIsStopping{false};
+	};
+}
+
+#endif
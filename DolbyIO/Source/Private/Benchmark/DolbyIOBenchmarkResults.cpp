@@ -0,0 +1,88 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Benchmark/DolbyIOBenchmarkResults.h"
+
+#if DOLBYIO_WITH_BENCHMARKS
+
+#include "Utils/DolbyIOLogging.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace DolbyIO
+{
+	FBenchmarkResults::FBenchmarkResults(const FString& Name) : Name(Name) {}
+
+	void FBenchmarkResults::Add(const FString& Case, FMetrics Metrics)
+	{
+		FString Line = Case;
+		for (const auto& Metric : Metrics)
+		{
+			Line += FString::Printf(TEXT(" %s=%.3f"), *Metric.Key, Metric.Value);
+		}
+		DLB_UE_LOG("[%s] %s", *Name, *Line);
+		Rows.Add(FRow{Case, MoveTemp(Metrics)});
+	}
+
+	void FBenchmarkResults::Save() const
+	{
+		TArray<FString> Columns;
+		for (const FRow& Row : Rows)
+		{
+			for (const auto& Metric : Row.Metrics)
+			{
+				Columns.AddUnique(Metric.Key);
+			}
+		}
+
+		FString Csv = "case";
+		for (const FString& Column : Columns)
+		{
+			Csv += "," + Column;
+		}
+		Csv += "\n";
+
+		TArray<TSharedPtr<FJsonValue>> JsonRows;
+		for (const FRow& Row : Rows)
+		{
+			TSharedRef<FJsonObject> JsonRow = MakeShared<FJsonObject>();
+			JsonRow->SetStringField("case", Row.Case);
+			Csv += Row.Case;
+			for (const FString& Column : Columns)
+			{
+				const auto* Metric = Row.Metrics.FindByPredicate([&Column](const auto& M) { return M.Key == Column; });
+				Csv += Metric ? FString::Printf(TEXT(",%f"), Metric->Value) : FString{","};
+				if (Metric)
+				{
+					JsonRow->SetNumberField(Column, Metric->Value);
+				}
+			}
+			Csv += "\n";
+			JsonRows.Add(MakeShared<FJsonValueObject>(JsonRow));
+		}
+
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetStringField("benchmark", Name);
+		Json->SetStringField("timestamp", FDateTime::UtcNow().ToIso8601());
+		Json->SetArrayField("results", JsonRows);
+		FString JsonString;
+		FJsonSerializer::Serialize(Json, TJsonWriterFactory<>::Create(&JsonString));
+
+		const FString BasePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("DolbyIO"),
+		                                         Name + "-" + FDateTime::Now().ToString());
+		FFileHelper::SaveStringToFile(Csv, *(BasePath + ".csv"));
+		FFileHelper::SaveStringToFile(JsonString, *(BasePath + ".json"));
+		DLB_UE_LOG("[%s] Results saved to %s.{csv,json}", *Name, *FPaths::ConvertRelativePathToFull(BasePath));
+	}
+
+	double CyclesToMs(uint64 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds64(Cycles);
+	}
+}
+
+#endif
@@ -0,0 +1,37 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#if DOLBYIO_WITH_BENCHMARKS
+
+#include "Containers/UnrealString.h"
+
+namespace DolbyIO
+{
+	// Collects benchmark results as rows of named metrics and saves them as CSV and JSON in
+	// <Project>/Saved/Profiling/DolbyIO so that runs can be compared by scripts.
+	class FBenchmarkResults final
+	{
+	public:
+		using FMetrics = TArray<TPair<FString, double>>;
+
+		explicit FBenchmarkResults(const FString& Name);
+
+		void Add(const FString& Case, FMetrics Metrics);
+		void Save() const;
+
+	private:
+		struct FRow
+		{
+			FString Case;
+			FMetrics Metrics;
+		};
+
+		const FString Name;
+		TArray<FRow> Rows;
+	};
+
+	double CyclesToMs(uint64 Cycles);
+}
+
+#endif
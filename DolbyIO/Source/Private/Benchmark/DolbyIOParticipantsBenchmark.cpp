@@ -0,0 +1,170 @@
+// Copyright 2023 Dolby Laboratories
+
+#if DOLBYIO_WITH_BENCHMARKS
+
+#include "DolbyIO.h"
+
+#include "Backend/DolbyIOFakeBackend.h"
+#include "Benchmark/DolbyIOBenchmarkResults.h"
+#include "Utils/DolbyIOEventQueue.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+#include <atomic>
+
+// Usage: DolbyIO.Benchmark.Participants [Count1 Count2 ...]
+// Replays join storms through the fake backend (installed if necessary), e.g. with
+// UnrealEditor-Cmd <Project> -game -nullrhi -unattended -ExecCmds="DolbyIO.Benchmark.Participants, Quit"
+namespace DolbyIO
+{
+	namespace
+	{
+		// Generous enough for the largest storms, short enough not to hang when e.g. connecting fails
+		constexpr double PumpTimeoutSeconds = 60.0;
+
+		struct FPumpStats
+		{
+			double GameThreadMs = 0.0;
+			uint64 PeakUsedPhysical = 0;
+			bool bIsTimedOut = false;
+		};
+
+		FPumpStats PumpGameThreadUntil(TFunctionRef<bool()> IsDone)
+		{
+			FPumpStats Ret;
+			const double Deadline = FPlatformTime::Seconds() + PumpTimeoutSeconds;
+			do
+			{
+				if (FPlatformTime::Seconds() > Deadline)
+				{
+					DLB_UE_LOG_BASE(Warning, "Benchmark timed out after %.0f s", PumpTimeoutSeconds);
+					Ret.bIsTimedOut = true;
+					break;
+				}
+
+				const uint64 Start = FPlatformTime::Cycles64();
+				FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+				FEventQueue::Drain();
+				Ret.GameThreadMs += CyclesToMs(FPlatformTime::Cycles64() - Start);
+				Ret.PeakUsedPhysical = FMath::Max(Ret.PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+				FPlatformProcess::SleepNoStats(0.0f);
+			} while (!IsDone());
+			return Ret;
+		}
+
+		bool BenchmarkJoinStorm(FBenchmarkResults& Results, UDolbyIOSubsystem& Subsystem, FFakeBackend& FakeBackend,
+		                        int Count)
+		{
+			DLB_TRACE_CPU_SCOPE(Benchmark_JoinStorm);
+
+			// connecting again empties the subsystem's participants from the previous run
+			Subsystem.Connect("benchmark");
+			if (PumpGameThreadUntil([&] { return FakeBackend.IsConnected(); }).bIsTimedOut)
+			{
+				DLB_UE_LOG_BASE(Warning, "Aborting benchmark - could not connect to the fake conference");
+				return false;
+			}
+
+			const uint64 UsedPhysicalBefore = FPlatformMemory::GetStats().UsedPhysical;
+			const uint64 NumEventsBefore = FEventQueue::GetNumEnqueued();
+			std::atomic<uint64> EventSourceEnd{0};
+
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int i = 0; i < Count; ++i)
+			{
+				FakeBackend.AddParticipant(FString::Printf(TEXT("Participant %d"), i));
+			}
+			FakeBackend.RunOnWorker([&] { EventSourceEnd = FPlatformTime::Cycles64(); });
+			const FPumpStats Stats =
+			    PumpGameThreadUntil([&] { return EventSourceEnd && !FEventQueue::GetNumPending(); });
+			const double TotalMs = CyclesToMs(FPlatformTime::Cycles64() - Start);
+			if (Stats.bIsTimedOut)
+			{
+				Subsystem.Disconnect();
+				return false;
+			}
+
+			const uint64 NumEvents = FEventQueue::GetNumEnqueued() - NumEventsBefore;
+			const double PeakDeltaMB =
+			    (static_cast<double>(FMath::Max(Stats.PeakUsedPhysical, UsedPhysicalBefore)) - UsedPhysicalBefore) /
+			    (1024.0 * 1024.0);
+			Results.Add(FString::Printf(TEXT("join_storm_%d"), Count),
+			            {{"participants", static_cast<double>(Count)},
+			             {"total_ms", TotalMs},
+			             {"event_source_ms", CyclesToMs(EventSourceEnd - Start)},
+			             {"game_thread_ms", Stats.GameThreadMs},
+			             {"game_thread_us_per_participant", Stats.GameThreadMs * 1000.0 / Count},
+			             {"events_queued", static_cast<double>(NumEvents)},
+			             {"events_per_participant", static_cast<double>(NumEvents) / Count},
+			             {"peak_memory_delta_mb", PeakDeltaMB}});
+
+			Subsystem.Disconnect();
+			return !PumpGameThreadUntil([&] { return !FakeBackend.IsConnected() && !FEventQueue::GetNumPending(); })
+			            .bIsTimedOut;
+		}
+
+		FAutoConsoleCommandWithWorldAndArgs ParticipantsBenchmarkCommand{
+		    TEXT("DolbyIO.Benchmark.Participants"),
+		    TEXT("Measures the cost of participants joining at once using the fake backend. Arguments: "
+		         "[Count1 Count2 ...] (default 100 1000 5000)"),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>& Args, UWorld* World)
+		        {
+			        UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+			        UDolbyIOSubsystem* Subsystem =
+			            GameInstance ? GameInstance->GetSubsystem<UDolbyIOSubsystem>() : nullptr;
+			        if (!Subsystem)
+			        {
+				        DLB_UE_LOG_BASE(Warning, "No Dolby.io subsystem in this world");
+				        return;
+			        }
+			        if (!FFakeBackend::Get(*Subsystem))
+			        {
+				        FFakeBackend::Install(*Subsystem);
+			        }
+			        FFakeBackend* FakeBackend = FFakeBackend::Get(*Subsystem);
+			        if (!FakeBackend)
+			        {
+				        return;
+			        }
+			        if (FakeBackend->IsConnected())
+			        {
+				        Subsystem->Disconnect();
+				        if (PumpGameThreadUntil([&] { return !FakeBackend->IsConnected(); }).bIsTimedOut)
+				        {
+					        return;
+				        }
+			        }
+
+			        TArray<int> Counts;
+			        for (const FString& Arg : Args)
+			        {
+				        Counts.Add(FMath::Max(FCString::Atoi(*Arg), 1));
+			        }
+			        if (!Counts.Num())
+			        {
+				        Counts = {100, 1000, 5000};
+			        }
+
+			        FBenchmarkResults Results{"ParticipantsBenchmark"};
+			        for (int Count : Counts)
+			        {
+				        if (!BenchmarkJoinStorm(Results, *Subsystem, *FakeBackend, Count))
+				        {
+					        break;
+				        }
+			        }
+			        Results.Save();
+		        })};
+	}
+}
+
+#endif
@@ -0,0 +1,234 @@
+// Copyright 2023 Dolby Laboratories
+
+#if DOLBYIO_WITH_BENCHMARKS
+
+#include "Benchmark/DolbyIOBenchmarkResults.h"
+#include "Utils/DolbyIOCppSdk.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOTrace.h"
+#include "Video/DolbyIOVideoSink.h"
+#include "Video/DolbyIOVideoTexture.h"
+
+#include <dolbyio/comms/media_engine/video_utils.h>
+
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "RenderingThread.h"
+
+#include <atomic>
+
+// Usage: DolbyIO.Benchmark.Video [Iterations] [EndToEndWidth] [EndToEndHeight]
+// Runs headless, e.g. UnrealEditor-Cmd <Project> -game -nullrhi -unattended -ExecCmds="DolbyIO.Benchmark.Video, Quit"
+namespace DolbyIO
+{
+	using namespace dolbyio::comms;
+
+	namespace
+	{
+		struct FResolution
+		{
+			int Width;
+			int Height;
+		};
+
+		constexpr FResolution Resolutions[] = {{320, 180}, {640, 360}, {1280, 720}, {1920, 1080}, {3840, 2160}};
+		constexpr int TrackCounts[] = {1, 2, 4, 8, 16, 32, 64};
+
+		FString ToString(const FResolution& Resolution)
+		{
+			return FString::Printf(TEXT("%dx%d"), Resolution.Width, Resolution.Height);
+		}
+
+		TArray<uint8> MakePlane(int Stride, int Height)
+		{
+			TArray<uint8> Ret;
+			Ret.SetNumUninitialized(Stride * Height);
+			for (int i = 0; i < Ret.Num(); ++i)
+			{
+				Ret[i] = static_cast<uint8>(i * 7);
+			}
+			return Ret;
+		}
+
+		template <class TConvert>
+		void BenchmarkConvert(FBenchmarkResults& Results, const TCHAR* Format, const FResolution& Resolution,
+		                      int Iterations, TConvert Convert)
+		{
+			const int DestStride = Resolution.Width * FVideoTexture::Stride;
+			TArray<uint8> Dest;
+			Dest.SetNumUninitialized(DestStride * Resolution.Height);
+
+			Convert(Dest.GetData(), DestStride); // warm-up
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int i = 0; i < Iterations; ++i)
+			{
+				Convert(Dest.GetData(), DestStride);
+			}
+			const double Ms = CyclesToMs(FPlatformTime::Cycles64() - Start);
+
+			const double Megapixels = static_cast<double>(Resolution.Width) * Resolution.Height * Iterations / 1e6;
+			Results.Add(FString::Printf(TEXT("convert_%s_%s"), Format, *ToString(Resolution)),
+			            {{"ms_per_frame", Ms / Iterations}, {"megapixels_per_second", Megapixels / (Ms / 1000.0)}});
+		}
+
+		void BenchmarkConverts(FBenchmarkResults& Results, int Iterations)
+		{
+			DLB_TRACE_CPU_SCOPE(Benchmark_Convert);
+
+			for (const FResolution& Resolution : Resolutions)
+			{
+				const int Width = Resolution.Width;
+				const int Height = Resolution.Height;
+				const int HalfWidth = (Width + 1) / 2;
+				const int HalfHeight = (Height + 1) / 2;
+
+				const TArray<uint8> ARGB = MakePlane(Width * 4, Height);
+				BenchmarkConvert(Results, TEXT("argb"), Resolution, Iterations,
+				                 [&](uint8* Dest, int DestStride) {
+					                 video_utils::format_converter::argb_copy(ARGB.GetData(), Width * 4, Dest,
+					                                                          DestStride, Width, Height);
+				                 });
+
+				const TArray<uint8> Y = MakePlane(Width, Height);
+				const TArray<uint8> U = MakePlane(HalfWidth, HalfHeight);
+				const TArray<uint8> V = MakePlane(HalfWidth, HalfHeight);
+				BenchmarkConvert(Results, TEXT("i420"), Resolution, Iterations,
+				                 [&](uint8* Dest, int DestStride)
+				                 {
+					                 video_utils::format_converter::i420_to_argb(
+					                     Y.GetData(), Width, U.GetData(), HalfWidth, V.GetData(), HalfWidth, Dest,
+					                     DestStride, Width, Height);
+				                 });
+
+				const TArray<uint8> UV = MakePlane(HalfWidth * 2, HalfHeight);
+				BenchmarkConvert(Results, TEXT("nv12"), Resolution, Iterations,
+				                 [&](uint8* Dest, int DestStride)
+				                 {
+					                 video_utils::format_converter::nv12_to_argb(Y.GetData(), Width, UV.GetData(),
+					                                                             HalfWidth * 2, Dest, DestStride,
+					                                                             Width, Height);
+				                 });
+			}
+		}
+
+		void BenchmarkUploads(FBenchmarkResults& Results, int Iterations)
+		{
+			DLB_TRACE_CPU_SCOPE(Benchmark_Upload);
+
+			for (const FResolution& Resolution : Resolutions)
+			{
+				TSharedRef<FVideoTexture> Texture = MakeShared<FVideoTexture>(Resolution.Width, Resolution.Height);
+				FlushRenderingCommands();
+
+				const uint64 Start = FPlatformTime::Cycles64();
+				for (int i = 0; i < Iterations; ++i)
+				{
+					Texture->Render(MakeShared<FFrameInFlight, ESPMode::ThreadSafe>());
+				}
+				FlushRenderingCommands();
+				const double Ms = CyclesToMs(FPlatformTime::Cycles64() - Start);
+
+				Results.Add(FString::Printf(TEXT("upload_%s"), *ToString(Resolution)),
+				            {{"ms_per_frame", Ms / Iterations}});
+			}
+		}
+
+		void PumpGameThreadUntil(TFunctionRef<bool()> IsDone)
+		{
+			while (!IsDone())
+			{
+				FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+				FPlatformProcess::SleepNoStats(0.0f);
+			}
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			FlushRenderingCommands();
+		}
+
+		void BenchmarkEndToEnd(FBenchmarkResults& Results, int Iterations, const FResolution& Resolution)
+		{
+			DLB_TRACE_CPU_SCOPE(Benchmark_EndToEnd);
+
+			for (int TrackCount : TrackCounts)
+			{
+				TArray<std::shared_ptr<FVideoSink>> Sinks;
+				for (int i = 0; i < TrackCount; ++i)
+				{
+					Sinks.Add(std::make_shared<FVideoSink>(FString::Printf(TEXT("benchmark-track-%d"), i)));
+				}
+
+				// One thread per track, like the SDK's decoders. The first frame of each track creates its texture,
+				// which needs the game thread, so it is excluded from the measurement.
+				std::atomic<int> NumReady{0};
+				std::atomic<int> NumDone{0};
+				std::atomic<bool> bGo{false};
+				TArray<TFuture<void>> Producers;
+				for (const std::shared_ptr<FVideoSink>& Sink : Sinks)
+				{
+					Producers.Add(Async(EAsyncExecution::Thread,
+					                    [&, Sink]
+					                    {
+						                    const auto Fill = [&](uint8* Buffer, int Stride)
+						                    { FMemory::Memset(Buffer, 0x80, Stride * Resolution.Height); };
+						                    Sink->HandleSyntheticFrame(Resolution.Width, Resolution.Height, Fill);
+						                    ++NumReady;
+						                    while (!bGo)
+						                    {
+							                    FPlatformProcess::SleepNoStats(0.0f);
+						                    }
+						                    for (int i = 0; i < Iterations; ++i)
+						                    {
+							                    Sink->HandleSyntheticFrame(Resolution.Width, Resolution.Height, Fill);
+						                    }
+						                    ++NumDone;
+					                    }));
+				}
+				PumpGameThreadUntil([&] { return NumReady == TrackCount; });
+
+				const uint64 Start = FPlatformTime::Cycles64();
+				bGo = true;
+				PumpGameThreadUntil([&] { return NumDone == TrackCount; });
+				const double Ms = CyclesToMs(FPlatformTime::Cycles64() - Start);
+				for (TFuture<void>& Producer : Producers)
+				{
+					Producer.Wait();
+				}
+
+				const double Frames = static_cast<double>(TrackCount) * Iterations;
+				Results.Add(FString::Printf(TEXT("end_to_end_%s_%d_tracks"), *ToString(Resolution), TrackCount),
+				            {{"tracks", static_cast<double>(TrackCount)},
+				             {"frames_per_second", Frames / (Ms / 1000.0)},
+				             {"ms_per_frame", Ms / Frames}});
+
+				for (const std::shared_ptr<FVideoSink>& Sink : Sinks)
+				{
+					Sink->UnbindAllMaterials();
+				}
+				Sinks.Empty();
+				PumpGameThreadUntil([] { return true; });
+			}
+		}
+
+		FAutoConsoleCommandWithWorldAndArgs VideoBenchmarkCommand{
+		    TEXT("DolbyIO.Benchmark.Video"),
+		    TEXT("Measures frame conversion, texture upload and end-to-end video sink throughput. Arguments: "
+		         "[Iterations] [EndToEndWidth] [EndToEndHeight]"),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		        [](const TArray<FString>& Args, UWorld*)
+		        {
+			        const int Iterations = Args.IsValidIndex(0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+			        const FResolution EndToEndResolution{Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 1280,
+			                                             Args.IsValidIndex(2) ? FCString::Atoi(*Args[2]) : 720};
+
+			        FBenchmarkResults Results{"VideoBenchmark"};
+			        BenchmarkConverts(Results, Iterations);
+			        BenchmarkUploads(Results, Iterations);
+			        BenchmarkEndToEnd(Results, Iterations, EndToEndResolution);
+			        Results.Save();
+		        })};
+	}
+}
+
+#endif
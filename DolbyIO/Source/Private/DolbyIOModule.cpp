@@ -1,10 +1,16 @@
 // Copyright 2023 Dolby Laboratories
 
 #include "Utils/DolbyIOCppSdk.h"
+#include "Utils/DolbyIOEventQueue.h"
+#include "Utils/DolbyIOLLM.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOSdkAllocator.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
 
 #include "HAL/PlatformProcess.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
 
@@ -15,15 +21,14 @@ class FDolbyIOModule final : public IModuleInterface
 public:
 	void StartupModule() override
 	{
+		DolbyIO::FEventQueue::Startup();
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&DolbyIO::FSdkAllocator::PublishStats);
+
 		FString BaseDir =
 		    FPaths::Combine(*IPluginManager::Get().FindPlugin("DolbyIO")->GetBaseDir(), TEXT("sdk-release"));
 #if PLATFORM_WINDOWS
 		using namespace dolbyio::comms;
-		app_allocator Allocator{
-		    ::operator new,
-		    [](std::size_t Count, std::size_t Al) { return ::operator new(Count, static_cast<std::align_val_t>(Al)); },
-		    ::operator delete,
-		    [](void* Ptr, std::size_t Al) { ::operator delete(Ptr, static_cast<std::align_val_t>(Al)); }};
+		const app_allocator Allocator = DolbyIO::FSdkAllocator::Get();
 		// Add this here as I am not sure how Windows paths are interpreted (do I need the backslash)
 		BaseDir = FPaths::Combine(BaseDir, TEXT("bin"));
 		LoadDll(BaseDir, "avutil-57.dll");
@@ -63,6 +68,9 @@ public:
 
 	void ShutdownModule() override
 	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		DolbyIO::FEventQueue::Shutdown();
+
 		while (Dlls.Num())
 		{
 			const FDll Dll = Dlls.Pop();
@@ -93,7 +101,38 @@ private:
 	};
 
 	TArray<FDll> Dlls;
+	FDelegateHandle EndFrameHandle;
 };
 
 IMPLEMENT_MODULE(FDolbyIOModule, DolbyIO)
 DEFINE_LOG_CATEGORY(LogDolbyIO);
+
+UE_TRACE_CHANNEL_DEFINE(DolbyIOChannel)
+TRACE_DECLARE_INT_COUNTER(DolbyIO_VideoTracks, TEXT("DolbyIO/VideoTracks"));
+TRACE_DECLARE_INT_COUNTER(DolbyIO_QueuedEvents, TEXT("DolbyIO/QueuedEvents"));
+TRACE_DECLARE_INT_COUNTER(DolbyIO_FramesInFlight, TEXT("DolbyIO/FramesInFlight"));
+
+#if ENGINE_MAJOR_VERSION == 5
+LLM_DEFINE_TAG(DolbyIO);
+LLM_DEFINE_TAG(DolbyIO_VideoBuffers, TEXT("VideoBuffers"), TEXT("DolbyIO"));
+LLM_DEFINE_TAG(DolbyIO_Textures, TEXT("Textures"), TEXT("DolbyIO"));
+LLM_DEFINE_TAG(DolbyIO_SdkInternal, TEXT("SdkInternal"), TEXT("DolbyIO"));
+#endif
+
+DEFINE_STAT(STAT_DolbyIO_ConvertFrame);
+DEFINE_STAT(STAT_DolbyIO_UploadTexture);
+DEFINE_STAT(STAT_DolbyIO_BroadcastEvent);
+DEFINE_STAT(STAT_DolbyIO_EventsBroadcast);
+DEFINE_STAT(STAT_DolbyIO_CollapsedEvents);
+DEFINE_STAT(STAT_DolbyIO_SdkAllocations);
+DEFINE_STAT(STAT_DolbyIO_ActiveSinks);
+DEFINE_STAT(STAT_DolbyIO_MaterialsBound);
+DEFINE_STAT(STAT_DolbyIO_RemoteParticipants);
+DEFINE_STAT(STAT_DolbyIO_PendingEvents);
+DEFINE_STAT(STAT_DolbyIO_SpatialUpdatesPerSecond);
+DEFINE_STAT(STAT_DolbyIO_CulledParticipants);
+DEFINE_STAT(STAT_DolbyIO_JoinTime);
+DEFINE_STAT(STAT_DolbyIO_FrameBufferMemory);
+DEFINE_STAT(STAT_DolbyIO_TextureMemory);
+DEFINE_STAT(STAT_DolbyIO_SdkMemory);
+DEFINE_STAT(STAT_DolbyIO_SdkPeakMemory);
@@ -0,0 +1,81 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Spatial/DolbyIOLocationInterpolator.h"
+
+#include "HAL/IConsoleManager.h"
+
+namespace DolbyIO
+{
+	namespace
+	{
+		TAutoConsoleVariable<float> CVarInterpolationDelayMs{
+		    TEXT("DolbyIO.Spatial.InterpolationDelayMs"), 100.0f,
+		    TEXT("Delay at which remote player locations added as samples are played back. Should be at least the "
+		         "interval at which samples are added.")};
+
+		TAutoConsoleVariable<float> CVarMaxExtrapolationMs{
+		    TEXT("DolbyIO.Spatial.MaxExtrapolationMs"), 250.0f,
+		    TEXT("Duration for which remote player locations are extrapolated past the latest sample.")};
+
+		constexpr double StaleSampleSeconds = 10.0;
+	}
+
+	void FLocationInterpolator::AddSample(FIDHandle ParticipantID, const FVector& Location, const FVector& Velocity,
+	                                      double Time)
+	{
+		TArray<FSample, TInlineAllocator<MaxSamples>>& ParticipantSamples = Samples.FindOrAdd(ParticipantID);
+		if (ParticipantSamples.Num() == MaxSamples)
+		{
+			ParticipantSamples.RemoveAt(0);
+		}
+		ParticipantSamples.Add({Time, Location, Velocity});
+	}
+
+	void FLocationInterpolator::Reset()
+	{
+		Samples.Reset();
+	}
+
+	void FLocationInterpolator::Evaluate(double Time, TMap<FIDHandle, FVector>& OutLocations)
+	{
+		const double PlaybackTime = Time - CVarInterpolationDelayMs.GetValueOnGameThread() / 1000.0;
+		const double MaxExtrapolation = CVarMaxExtrapolationMs.GetValueOnGameThread() / 1000.0;
+		for (auto It = Samples.CreateIterator(); It; ++It)
+		{
+			const TArray<FSample, TInlineAllocator<MaxSamples>>& ParticipantSamples = It.Value();
+			const FSample& Latest = ParticipantSamples.Last();
+			if (Time - Latest.Time > StaleSampleSeconds)
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+
+			if (PlaybackTime >= Latest.Time)
+			{
+				const double Extrapolation = FMath::Min(PlaybackTime - Latest.Time, MaxExtrapolation);
+				OutLocations.Add(It.Key(), Latest.Location + Latest.Velocity * Extrapolation);
+				continue;
+			}
+
+			// Find the pair of samples around the playback time and interpolate along the Hermite curve given by their
+			// locations and velocities, which keeps the motion smooth across samples.
+			int32 Next = 1;
+			while (Next < ParticipantSamples.Num() - 1 && ParticipantSamples[Next].Time <= PlaybackTime)
+			{
+				++Next;
+			}
+			if (Next == ParticipantSamples.Num() || PlaybackTime <= ParticipantSamples[Next - 1].Time)
+			{
+				OutLocations.Add(It.Key(), ParticipantSamples[Next - 1].Location);
+				continue;
+			}
+
+			const FSample& From = ParticipantSamples[Next - 1];
+			const FSample& To = ParticipantSamples[Next];
+			const double Duration = To.Time - From.Time;
+			const float Alpha = (PlaybackTime - From.Time) / Duration;
+			OutLocations.Add(It.Key(), FMath::CubicInterp(From.Location, From.Velocity * Duration, To.Location,
+			                                              To.Velocity * Duration, Alpha));
+		}
+	}
+}
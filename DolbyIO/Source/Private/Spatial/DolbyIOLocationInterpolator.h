@@ -0,0 +1,37 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "DolbyIO.h"
+
+#include "Containers/ContainerAllocationPolicies.h"
+
+namespace DolbyIO
+{
+	// Recent location samples of remote participants, which can be sent at a low rate, from which smooth locations are
+	// evaluated every frame. Locations are evaluated DolbyIO.Spatial.InterpolationDelayMs in the past, so that they
+	// usually lie between two received samples, and are extrapolated using the latest velocity for at most
+	// DolbyIO.Spatial.MaxExtrapolationMs when no newer sample has arrived. Only accessed from the game thread.
+	class FLocationInterpolator final
+	{
+	public:
+		void AddSample(FIDHandle ParticipantID, const FVector& Location, const FVector& Velocity, double Time);
+		void Reset();
+
+		// Adds the location of every participant with samples at the given time to the map. Participants without new
+		// samples for a while are forgotten.
+		void Evaluate(double Time, TMap<FIDHandle, FVector>& OutLocations);
+
+	private:
+		struct FSample
+		{
+			double Time;
+			FVector Location;
+			FVector Velocity;
+		};
+
+		static constexpr int32 MaxSamples = 4;
+
+		TMap<FIDHandle, TArray<FSample, TInlineAllocator<MaxSamples>>> Samples;
+	};
+}
@@ -0,0 +1,144 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Spatial/DolbyIOSpatialCommandQueue.h"
+
+#include "Utils/DolbyIOTrace.h"
+
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+
+namespace DolbyIO
+{
+	void FSpatialCommandQueue::FSlot::Store(const FVector& Value, FIDHandle InParticipantID)
+	{
+		const uint32 Start = Sequence.load(std::memory_order_relaxed);
+		Sequence.store(Start + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		X.store(Value.X, std::memory_order_relaxed);
+		Y.store(Value.Y, std::memory_order_relaxed);
+		Z.store(Value.Z, std::memory_order_relaxed);
+		ParticipantID.store(InParticipantID, std::memory_order_relaxed);
+		Sequence.store(Start + 2, std::memory_order_release);
+		bIsPending = true;
+	}
+
+	bool FSpatialCommandQueue::FSlot::IsPending() const
+	{
+		return bIsPending;
+	}
+
+	void FSpatialCommandQueue::FSlot::Discard()
+	{
+		bIsPending = false;
+	}
+
+	bool FSpatialCommandQueue::FSlot::Take(FVector& OutValue, FIDHandle& OutParticipantID)
+	{
+		if (!bIsPending.exchange(false, std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		uint32 Start;
+		uint32 End;
+		do
+		{
+			Start = Sequence.load(std::memory_order_acquire);
+			OutValue.X = X.load(std::memory_order_relaxed);
+			OutValue.Y = Y.load(std::memory_order_relaxed);
+			OutValue.Z = Z.load(std::memory_order_relaxed);
+			OutParticipantID = ParticipantID.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			End = Sequence.load(std::memory_order_relaxed);
+		} while (Start != End || (Start & 1));
+		return true;
+	}
+
+	FSpatialCommandQueue::FSpatialCommandQueue(FHandler Handler) : Handler(MoveTemp(Handler))
+	{
+		WakeUpEvent = FPlatformProcess::GetSynchEventFromPool();
+		Thread = FRunnableThread::Create(this, TEXT("DolbyIOSpatialCommands"));
+	}
+
+	FSpatialCommandQueue::~FSpatialCommandQueue()
+	{
+		Shutdown();
+		FPlatformProcess::ReturnSynchEventToPool(WakeUpEvent);
+	}
+
+	void FSpatialCommandQueue::Shutdown()
+	{
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+			Thread = nullptr;
+		}
+	}
+
+	void FSpatialCommandQueue::Push(ECommand Command, const FVector& Value, FIDHandle ParticipantID)
+	{
+		Slots[static_cast<int>(Command)].Store(Value, ParticipantID);
+
+		// Only wake the worker up when it is waiting, which happens at most once per forwarded batch of commands
+		if (bIsWorkerIdle && bIsWorkerIdle.exchange(false))
+		{
+			WakeUpEvent->Trigger();
+		}
+	}
+
+	void FSpatialCommandQueue::Discard()
+	{
+		for (FSlot& Slot : Slots)
+		{
+			Slot.Discard();
+		}
+	}
+
+	uint32 FSpatialCommandQueue::Run()
+	{
+		while (!bIsStopping)
+		{
+			bool bHasForwarded = false;
+			for (int Command = 0; Command < static_cast<int>(ECommand::Count); ++Command)
+			{
+				FVector Value;
+				FIDHandle ParticipantID;
+				if (Slots[Command].Take(Value, ParticipantID))
+				{
+					DLB_TRACE_CPU_SCOPE(ForwardSpatialCommand);
+					Handler(static_cast<ECommand>(Command), Value, ParticipantID);
+					bHasForwarded = true;
+				}
+			}
+
+			if (!bHasForwarded)
+			{
+				// Announce being idle before checking the slots once more, so that a value stored in between either
+				// is seen here or makes the writer wake the worker up
+				bIsWorkerIdle = true;
+				bool bIsAnyPending = false;
+				for (const FSlot& Slot : Slots)
+				{
+					bIsAnyPending |= Slot.IsPending();
+				}
+				if (bIsAnyPending)
+				{
+					bIsWorkerIdle = false;
+				}
+				else
+				{
+					WakeUpEvent->Wait();
+				}
+			}
+		}
+		return 0;
+	}
+
+	void FSpatialCommandQueue::Stop()
+	{
+		bIsStopping = true;
+		WakeUpEvent->Trigger();
+	}
+}
@@ -0,0 +1,77 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Utils/DolbyIOIDTable.h"
+
+#include "HAL/Runnable.h"
+#include "Math/Vector.h"
+#include "Templates/Function.h"
+
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+
+namespace DolbyIO
+{
+	// Forwards spatial commands to the SDK from a worker thread. Each command has a single-slot mailbox holding only
+	// the latest value, so the game thread publishes a value with a few atomic stores and never blocks, and values
+	// published faster than the worker forwards them are collapsed. Each value carries the participant it was published
+	// for, so that the worker never reads subsystem state which the game thread may be changing.
+	class FSpatialCommandQueue final : public FRunnable
+	{
+	public:
+		enum class ECommand
+		{
+			LocalPosition,
+			LocalDirection,
+			Count
+		};
+		using FHandler = TFunction<void(ECommand, const FVector&, FIDHandle ParticipantID)>;
+
+		// The handler is called on the worker thread with the latest value of each command.
+		explicit FSpatialCommandQueue(FHandler Handler);
+		~FSpatialCommandQueue();
+
+		// Only to be called from a single thread.
+		void Push(ECommand Command, const FVector& Value, FIDHandle ParticipantID);
+		// Drops the values not forwarded yet. A value the worker has already taken is still forwarded.
+		void Discard();
+		// Stops and joins the worker. Values pushed afterwards are never forwarded, so the queue can stay in use
+		// until it is destroyed.
+		void Shutdown();
+
+	private:
+		// Sequence lock over the components of a vector: the sequence is odd while the writer is storing, so the reader
+		// retries when the sequence changes while it loads.
+		class FSlot
+		{
+		public:
+			void Store(const FVector& Value, FIDHandle ParticipantID);
+			bool Take(FVector& OutValue, FIDHandle& OutParticipantID);
+			bool IsPending() const;
+			void Discard();
+
+		private:
+			using FReal = decltype(FVector::X); // float in UE4, double in UE5
+
+			std::atomic<uint32> Sequence{0};
+			std::atomic<FReal> X{0};
+			std::atomic<FReal> Y{0};
+			std::atomic<FReal> Z{0};
+			std::atomic<FIDHandle> ParticipantID{InvalidIDHandle};
+			std::atomic<bool> bIsPending{false};
+		};
+
+		uint32 Run() override;
+		void Stop() override;
+
+		FHandler Handler;
+		FSlot Slots[static_cast<int>(ECommand::Count)];
+		std::atomic<bool> bIsWorkerIdle{false};
+		std::atomic<bool> bIsStopping{false};
+		FEvent* WakeUpEvent = nullptr;
+		FRunnableThread* Thread = nullptr;
+	};
+}
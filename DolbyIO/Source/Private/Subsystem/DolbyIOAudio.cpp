@@ -2,17 +2,45 @@
 
 #include "DolbyIO.h"
 
+#include "Audio/DolbyIOAudioLevels.h"
 #include "Utils/DolbyIOBroadcastEvent.h"
+#include "Utils/DolbyIOConnectionTimer.h"
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOIDTable.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "HAL/IConsoleManager.h"
 
 using namespace dolbyio::comms;
 using namespace DolbyIO;
 
+namespace
+{
+	TAutoConsoleVariable<float> CVarCullingRadius{
+	    TEXT("DolbyIO.Culling.Radius"), 0.0f,
+	    TEXT("Distance from the local player beyond which the audio of remote participants is stopped. 0 disables "
+	         "culling by distance.")};
+
+	TAutoConsoleVariable<int32> CVarCullingMaxAudibleParticipants{
+	    TEXT("DolbyIO.Culling.MaxAudibleParticipants"), 0,
+	    TEXT("Number of closest remote participants whose audio is played, the audio of the others is stopped. "
+	         "Participants without a location are always played and count toward the number. 0 means no limit.")};
+
+	TAutoConsoleVariable<float> CVarCullingHysteresis{
+	    TEXT("DolbyIO.Culling.Hysteresis"), 0.1f,
+	    TEXT("Fraction of their distance by which audible participants are favoured over culled ones, so that "
+	         "participants near the limits do not keep switching between audible and culled.")};
+
+	TAutoConsoleVariable<float> CVarCullingIntervalSeconds{
+	    TEXT("DolbyIO.Culling.IntervalSeconds"), 0.25f, TEXT("Interval at which culling is evaluated.")};
+}
+
 void UDolbyIOSubsystem::SetSpatialEnvironment()
 {
-	if (!IsConnectedAsActive() || !IsSpatialAudio())
+	if (!Sdk || !IsConnectedAsActive() || !IsSpatialAudio())
 	{
 		return;
 	}
@@ -66,7 +94,7 @@ void UDolbyIOSubsystem::UnmuteOutput()
 
 void UDolbyIOSubsystem::ToggleInputMute()
 {
-	if (IsConnectedAsActive())
+	if (Sdk && IsConnectedAsActive())
 	{
 		Sdk->conference()
 		    .mute(bIsInputMuted)
@@ -76,7 +104,7 @@ void UDolbyIOSubsystem::ToggleInputMute()
 
 void UDolbyIOSubsystem::ToggleOutputMute()
 {
-	if (IsConnected() && ConnectionMode != EDolbyIOConnectionMode::ListenerRTS)
+	if (Sdk && IsConnected() && ConnectionMode != EDolbyIOConnectionMode::ListenerRTS)
 	{
 		Sdk->conference()
 		    .mute_output(bIsOutputMuted)
@@ -86,24 +114,161 @@ void UDolbyIOSubsystem::ToggleOutputMute()
 
 void UDolbyIOSubsystem::MuteParticipant(const FString& ParticipantID)
 {
-	if (!IsConnected() || ParticipantID == LocalParticipantID)
+	if (!Sdk || !IsConnected() || ParticipantID == LocalParticipantID)
+	{
+		return;
+	}
+
+	const FIDHandle ID = FIDTable::Find(ParticipantID);
+	if (ID == InvalidIDHandle)
 	{
+		DLB_WARNING(OnMuteParticipantError, "Cannot mute participant - unknown participant ID " + ParticipantID);
 		return;
 	}
 
 	DLB_UE_LOG("Muting participant ID %s", *ParticipantID);
-	Sdk->audio().remote().stop(ToStdString(ParticipantID)).on_error(DLB_ERROR_HANDLER(OnMuteParticipantError));
+	MutedParticipants.Add(ID);
+	if (!CulledParticipants.Contains(ID))
+	{
+		Sdk->audio().remote().stop(FIDTable::ToStdString(ID)).on_error(DLB_ERROR_HANDLER(OnMuteParticipantError));
+	}
 }
 
 void UDolbyIOSubsystem::UnmuteParticipant(const FString& ParticipantID)
 {
-	if (!IsConnected() || ParticipantID == LocalParticipantID)
+	if (!Sdk || !IsConnected() || ParticipantID == LocalParticipantID)
+	{
+		return;
+	}
+
+	const FIDHandle ID = FIDTable::Find(ParticipantID);
+	if (ID == InvalidIDHandle)
 	{
+		DLB_WARNING(OnUnmuteParticipantError, "Cannot unmute participant - unknown participant ID " + ParticipantID);
 		return;
 	}
 
 	DLB_UE_LOG("Unmuting participant ID %s", *ParticipantID);
-	Sdk->audio().remote().start(ToStdString(ParticipantID)).on_error(DLB_ERROR_HANDLER(OnUnmuteParticipantError));
+	MutedParticipants.Remove(ID);
+	if (!CulledParticipants.Contains(ID))
+	{
+		Sdk->audio().remote().start(FIDTable::ToStdString(ID)).on_error(DLB_ERROR_HANDLER(OnUnmuteParticipantError));
+	}
+}
+
+void UDolbyIOSubsystem::UpdateAudioCulling()
+{
+	if (!IsConnected())
+	{
+		MutedParticipants.Reset();
+		CulledParticipants.Reset();
+		return;
+	}
+
+	const float Radius = CVarCullingRadius.GetValueOnGameThread();
+	const int32 MaxAudibleParticipants = CVarCullingMaxAudibleParticipants.GetValueOnGameThread();
+	if (!CanSetRemotePlayerLocations() || (Radius <= 0.0f && MaxAudibleParticipants <= 0))
+	{
+		if (CulledParticipants.Num())
+		{
+			for (const FIDHandle ParticipantID : CulledParticipants.Array())
+			{
+				SetParticipantCulled(ParticipantID, false);
+			}
+			SET_DWORD_STAT(STAT_DolbyIO_CulledParticipants, 0);
+		}
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastCullingTime < CVarCullingIntervalSeconds.GetValueOnGameThread())
+	{
+		return;
+	}
+	LastCullingTime = Now;
+
+	// Culled participants are ranked as if they were further away, so they have to come noticeably closer than the
+	// audible ones to replace them or to get back inside the radius.
+	const float Hysteresis = 1.0f + FMath::Max(CVarCullingHysteresis.GetValueOnGameThread(), 0.0f);
+	CullingCandidates.Reset();
+	int32 NumAudibleWithoutLocation = 0;
+	{
+		FScopeLock Lock{&RemoteParticipantsLock};
+		for (auto It = CulledParticipants.CreateIterator(); It; ++It)
+		{
+			if (!RemoteParticipants.Contains(*It))
+			{
+				It.RemoveCurrent();
+			}
+		}
+		for (const auto& Location : LastSentRemoteLocations)
+		{
+			if (RemoteParticipants.Contains(Location.Key))
+			{
+				const float Distance = FVector::Dist(Location.Value, LastSentLocation);
+				CullingCandidates.Emplace(CulledParticipants.Contains(Location.Key) ? Distance * Hysteresis : Distance,
+				                          Location.Key);
+			}
+		}
+		// Participants whose location was never set cannot be ranked and are never culled, but they are audible, so
+		// they take up places among the closest participants
+		for (const auto& Participant : RemoteParticipants)
+		{
+			NumAudibleWithoutLocation += Participant.Value.Status == EDolbyIOParticipantStatus::OnAir &&
+			                             !LastSentRemoteLocations.Contains(Participant.Key) &&
+			                             !MutedParticipants.Contains(Participant.Key);
+		}
+	}
+	CullingCandidates.Sort([](const TPair<float, FIDHandle>& Lhs, const TPair<float, FIDHandle>& Rhs)
+	                       { return Lhs.Key < Rhs.Key; });
+
+	const int32 MaxAudibleCandidates = FMath::Max(MaxAudibleParticipants - NumAudibleWithoutLocation, 0);
+	for (int32 i = 0; i < CullingCandidates.Num(); ++i)
+	{
+		const bool bIsCulled = (Radius > 0.0f && CullingCandidates[i].Key > Radius * Hysteresis) ||
+		                       (MaxAudibleParticipants > 0 && i >= MaxAudibleCandidates);
+		SetParticipantCulled(CullingCandidates[i].Value, bIsCulled);
+	}
+	SET_DWORD_STAT(STAT_DolbyIO_CulledParticipants, CulledParticipants.Num());
+}
+
+void UDolbyIOSubsystem::SetParticipantCulled(FIDHandle ParticipantID, bool bIsCulled)
+{
+	if (bIsCulled == CulledParticipants.Contains(ParticipantID))
+	{
+		return;
+	}
+
+	DLB_UE_LOG("%s participant ID %s", bIsCulled ? TEXT("Culling") : TEXT("Unculling"),
+	           *FIDTable::ToFString(ParticipantID));
+	if (bIsCulled)
+	{
+		CulledParticipants.Add(ParticipantID);
+	}
+	else
+	{
+		CulledParticipants.Remove(ParticipantID);
+	}
+
+	// Participants muted by the user stay muted regardless of culling
+	if (MutedParticipants.Contains(ParticipantID))
+	{
+		return;
+	}
+	if (bIsCulled)
+	{
+		Sdk->audio()
+		    .remote()
+		    .stop(FIDTable::ToStdString(ParticipantID))
+		    .on_error(DLB_ERROR_HANDLER(OnMuteParticipantError));
+	}
+	else
+	{
+		Sdk->audio()
+		    .remote()
+		    .start(FIDTable::ToStdString(ParticipantID))
+		    .on_error(DLB_ERROR_HANDLER(OnUnmuteParticipantError));
+	}
 }
 
 bool UDolbyIOSubsystem::IsSpatialAudio() const
@@ -129,22 +294,102 @@ void UDolbyIOSubsystem::SetAudioCaptureMode(EDolbyIONoiseReduction NoiseReductio
 
 void UDolbyIOSubsystem::Handle(const active_speaker_changed& Event)
 {
+	DLB_TRACE_CPU_SCOPE(Handle_active_speaker_changed);
+
+	FScopeLock Lock{&RemoteParticipantsLock};
 	TArray<FString> ActiveSpeakers;
+	NewActiveSpeakerIDs.Reset();
 	for (const std::string& Speaker : Event.active_speakers)
 	{
-		ActiveSpeakers.Add(ToFString(Speaker));
+		const FIDHandle ParticipantID = FIDTable::Intern(Speaker);
+		ActiveSpeakers.Add(FIDTable::ToFString(ParticipantID));
+		NewActiveSpeakerIDs.Add(ParticipantID);
 	}
-	BroadcastEvent(OnActiveSpeakersChanged, ActiveSpeakers);
+	BroadcastCoalescedEventWithNative(*this, OnActiveSpeakersChanged, OnActiveSpeakersChangedNative, "",
+	                                  ActiveSpeakers);
+
+	// Both lists are sorted, so a single merge pass finds the speakers who started and stopped
+	NewActiveSpeakerIDs.Sort();
+	int Old = 0;
+	int New = 0;
+	while (Old < ActiveSpeakerIDs.Num() || New < NewActiveSpeakerIDs.Num())
+	{
+		if (New == NewActiveSpeakerIDs.Num() ||
+		    (Old < ActiveSpeakerIDs.Num() && ActiveSpeakerIDs[Old] < NewActiveSpeakerIDs[New]))
+		{
+			BroadcastEventWithNative(*this, OnSpeakerStopped, OnSpeakerStoppedNative,
+			                         FIDTable::ToFString(ActiveSpeakerIDs[Old++]));
+		}
+		else if (Old == ActiveSpeakerIDs.Num() || NewActiveSpeakerIDs[New] < ActiveSpeakerIDs[Old])
+		{
+			BroadcastEventWithNative(*this, OnSpeakerStarted, OnSpeakerStartedNative,
+			                         FIDTable::ToFString(NewActiveSpeakerIDs[New++]));
+		}
+		else
+		{
+			++Old;
+			++New;
+		}
+	}
+	Swap(ActiveSpeakerIDs, NewActiveSpeakerIDs);
 }
 
 void UDolbyIOSubsystem::Handle(const audio_levels& Event)
 {
-	TArray<FString> ActiveSpeakers;
-	TArray<float> AudioLevels;
-	for (const audio_level& Level : Event.levels)
+	DLB_TRACE_CPU_SCOPE(Handle_audio_levels);
+
+	if (!Event.levels.empty())
+	{
+		ConnectionTimer->Record(FConnectionTimer::EStage::FirstAudioLevel);
+	}
+	AudioLevelTable->Update(Event.levels);
+
+	if (FEventQueue::IsCoalescingEnabled())
+	{
+		// The broadcast reads the latest levels when it runs, so there is no point in queueing more than one
+		if (!bIsAudioLevelsBroadcastPending.exchange(true))
+		{
+			FEventQueue::Enqueue(*this, [this] { BroadcastAudioLevels(); });
+		}
+	}
+	else
 	{
-		ActiveSpeakers.Add(ToFString(Level.participant_id));
-		AudioLevels.Add(Level.level);
+		TArray<FString> ActiveSpeakers;
+		TArray<float> AudioLevels;
+		AudioLevelTable->Get(ActiveSpeakers, AudioLevels);
+		BroadcastEventWithNative(*this, OnAudioLevelsChanged, OnAudioLevelsChangedNative, ActiveSpeakers, AudioLevels);
 	}
-	BroadcastEvent(OnAudioLevelsChanged, ActiveSpeakers, AudioLevels);
+}
+
+void UDolbyIOSubsystem::BroadcastAudioLevels()
+{
+	bIsAudioLevelsBroadcastPending = false;
+	if (!OnAudioLevelsChanged.IsBound() && !OnAudioLevelsChangedNative.IsBound())
+	{
+		return;
+	}
+
+	AudioLevelTable->Get(BroadcastActiveSpeakers, BroadcastAudioLevelValues);
+	OnAudioLevelsChanged.Broadcast(BroadcastActiveSpeakers, BroadcastAudioLevelValues);
+	OnAudioLevelsChangedNative.Broadcast(BroadcastActiveSpeakers, BroadcastAudioLevelValues);
+}
+
+float UDolbyIOSubsystem::GetAudioLevel(const FString& ParticipantID) const
+{
+	return AudioLevelTable ? AudioLevelTable->Get(FIDTable::Find(ParticipantID)) : 0.0f;
+}
+
+float UDolbyIOSubsystem::GetSmoothedAudioLevel(const FString& ParticipantID) const
+{
+	return AudioLevelTable ? AudioLevelTable->GetSmoothed(FIDTable::Find(ParticipantID)) : 0.0f;
+}
+
+float UDolbyIOSubsystem::GetPeakAudioLevel(const FString& ParticipantID) const
+{
+	return AudioLevelTable ? AudioLevelTable->GetPeak(FIDTable::Find(ParticipantID)) : 0.0f;
+}
+
+bool UDolbyIOSubsystem::IsParticipantSpeaking(const FString& ParticipantID, float MinDurationMs) const
+{
+	return AudioLevelTable && AudioLevelTable->IsSpeakingFor(FIDTable::Find(ParticipantID), MinDurationMs);
 }
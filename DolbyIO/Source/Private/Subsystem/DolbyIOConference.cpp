@@ -2,14 +2,195 @@
 
 #include "DolbyIO.h"
 
+#include "Audio/DolbyIOAudioLevels.h"
+#include "Backend/DolbyIOFakeBackend.h"
+#include "Spatial/DolbyIOSpatialCommandQueue.h"
 #include "Utils/DolbyIOBroadcastEvent.h"
+#include "Utils/DolbyIOConnectionTimer.h"
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOIDTable.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "HAL/IConsoleManager.h"
 
 using namespace dolbyio::comms;
 using namespace DolbyIO;
 
+namespace
+{
+	TAutoConsoleVariable<int32> CVarReconnectMaxAttempts{
+	    TEXT("DolbyIO.Reconnect.MaxAttempts"), 5,
+	    TEXT("Number of attempts to reconnect after losing connection before giving up.")};
+
+	TAutoConsoleVariable<float> CVarReconnectInitialDelayMs{
+	    TEXT("DolbyIO.Reconnect.InitialDelayMs"), 500.0f,
+	    TEXT("Delay before the first reconnect attempt, doubled for every next attempt.")};
+
+	TAutoConsoleVariable<float> CVarReconnectMaxDelayMs{TEXT("DolbyIO.Reconnect.MaxDelayMs"), 8000.0f,
+	                                                    TEXT("Longest delay between reconnect attempts.")};
+
+	constexpr double ReconnectGraceSeconds = 5.0;
+}
+
+namespace
+{
+	FString MakeSessionKey(const FString& UserName, const FString& ExternalID, const FString& AvatarURL)
+	{
+		return UserName + TEXT("\n") + ExternalID + TEXT("\n") + AvatarURL;
+	}
+
+	FString MakeConferenceKey(const FString& ConferenceName, EDolbyIOSpatialAudioStyle SpatialAudioStyle,
+	                          EDolbyIOVideoCodec VideoCodec)
+	{
+		return ConferenceName + TEXT("\n") + UEnum::GetValueAsString(SpatialAudioStyle) + TEXT("\n") +
+		       UEnum::GetValueAsString(VideoCodec);
+	}
+
+	services::session::user_info MakeUserInfo(const FString& UserName, const FString& ExternalID,
+	                                          const FString& AvatarURL)
+	{
+		services::session::user_info UserInfo{};
+		UserInfo.name = ToStdString(UserName);
+		UserInfo.externalId = ToStdString(ExternalID);
+		UserInfo.avatarUrl = ToStdString(AvatarURL);
+		return UserInfo;
+	}
+}
+
+void UDolbyIOSubsystem::WarmUpConnection(const FString& ConferenceName, const FString& UserName,
+                                         const FString& ExternalID, const FString& AvatarURL,
+                                         EDolbyIOSpatialAudioStyle SpatialStyle, EDolbyIOVideoCodec VideoCodec)
+{
+	using namespace dolbyio::comms::services;
+
+	if (!CanConnect(OnWarmUpConnectionError))
+	{
+		return;
+	}
+
+	const FString SessionKey = MakeSessionKey(UserName, ExternalID, AvatarURL);
+	const FString ConferenceKey =
+	    ConferenceName.IsEmpty() ? FString{} : MakeConferenceKey(ConferenceName, SpatialStyle, VideoCodec);
+	bool bIsSessionOpen;
+	bool bIsConferenceCreated;
+	{
+		FScopeLock Lock{&WarmUpLock};
+		if (bIsWarmingUp)
+		{
+			DLB_WARNING(OnWarmUpConnectionError, "Cannot warm up connection - already warming up");
+			return;
+		}
+		if (!OpenSessionKey.IsEmpty() && OpenSessionKey != SessionKey)
+		{
+			DLB_WARNING(OnWarmUpConnectionError,
+			            "Cannot warm up connection - a session is already open with different user information");
+			return;
+		}
+		bIsWarmingUp = true;
+		bIsSessionOpen = !OpenSessionKey.IsEmpty();
+		bIsConferenceCreated = ConferenceKey.IsEmpty() || WarmConferenceKey == ConferenceKey;
+	}
+
+	DLB_UE_LOG("Warming up connection to conference %s with user name \"%s\"", *ConferenceName, *UserName);
+
+#if DOLBYIO_WITH_FAKE_BACKEND
+	if (FakeBackend)
+	{
+		return FakeBackend->WarmUp(bIsSessionOpen, bIsConferenceCreated,
+		                           [this, SessionKey, ConferenceKey]
+		                           {
+			                           {
+				                           FScopeLock Lock{&WarmUpLock};
+				                           OpenSessionKey = SessionKey;
+				                           if (!ConferenceKey.IsEmpty())
+				                           {
+					                           WarmConferenceKey = ConferenceKey;
+				                           }
+			                           }
+			                           FinishWarmUp();
+		                           });
+	}
+#endif
+
+	const auto CreateConference =
+	    [this, ConferenceKey, ConferenceName = ToStdString(ConferenceName),
+	     SpatialStyle = ToSdkSpatialAudioStyle(SpatialStyle), VideoCodec = ToSdkVideoCodec(VideoCodec)]
+	{
+		if (ConferenceKey.IsEmpty())
+		{
+			return FinishWarmUp();
+		}
+
+		conference::conference_options Options{};
+		Options.alias = ConferenceName;
+		Options.params.spatial_audio_style = SpatialStyle;
+		Options.params.video_codec = VideoCodec;
+		Sdk->conference()
+		    .create(Options)
+		    .then(
+		        [this, ConferenceKey](conference_info&& ConferenceInfo)
+		        {
+			        {
+				        FScopeLock Lock{&WarmUpLock};
+				        WarmConferenceKey = ConferenceKey;
+				        WarmConferenceInfo = MakeShared<conference_info>(MoveTemp(ConferenceInfo));
+			        }
+			        FinishWarmUp();
+		        })
+		    .on_error(
+		        [this, ErrorHandler = DLB_ERROR_HANDLER(OnWarmUpConnectionError)](std::exception_ptr&& ExcPtr)
+		        {
+			        ErrorHandler(MoveTemp(ExcPtr));
+			        FinishWarmUp();
+		        });
+	};
+
+	if (bIsSessionOpen)
+	{
+		return bIsConferenceCreated ? FinishWarmUp() : CreateConference();
+	}
+
+	Sdk->session()
+	    .open(MakeUserInfo(UserName, ExternalID, AvatarURL))
+	    .then(
+	        [this, SessionKey, CreateConference, bIsConferenceCreated](services::session::user_info&& User)
+	        {
+		        DLB_TRACE_CPU_SCOPE(WarmUp_SessionOpened);
+		        LocalParticipantID = ToFString(User.participant_id.value_or(""));
+		        {
+			        FScopeLock Lock{&WarmUpLock};
+			        OpenSessionKey = SessionKey;
+		        }
+		        bIsConferenceCreated ? FinishWarmUp() : CreateConference();
+	        })
+	    .on_error(
+	        [this, ErrorHandler = DLB_ERROR_HANDLER(OnWarmUpConnectionError)](std::exception_ptr&& ExcPtr)
+	        {
+		        ErrorHandler(MoveTemp(ExcPtr));
+		        FinishWarmUp();
+	        });
+}
+
+void UDolbyIOSubsystem::FinishWarmUp()
+{
+	TFunction<void()> Connect;
+	{
+		FScopeLock Lock{&WarmUpLock};
+		bIsWarmingUp = false;
+		Connect = MoveTemp(ConnectAfterWarmUp);
+		ConnectAfterWarmUp = nullptr;
+	}
+
+	DLB_UE_LOG("Connection warm-up finished");
+	if (Connect)
+	{
+		FEventQueue::Enqueue(*this, MoveTemp(Connect));
+	}
+}
+
 void UDolbyIOSubsystem::Connect(const FString& ConferenceName, const FString& UserName, const FString& ExternalID,
                                 const FString& AvatarURL, EDolbyIOConnectionMode ConnMode,
                                 EDolbyIOSpatialAudioStyle SpatialStyle, int MaxVideoStreams,
@@ -26,69 +207,189 @@ void UDolbyIOSubsystem::Connect(const FString& ConferenceName, const FString& Us
 		DLB_WARNING(OnConnectError, "Cannot connect - conference name cannot be empty");
 		return;
 	}
+	if (bIsReconnecting && !bIsAttemptingReconnect)
+	{
+		DLB_WARNING(OnConnectError, "Cannot connect - reconnecting, please disconnect first");
+		return;
+	}
+
+	const auto RepeatConnect = [this, ConferenceName, UserName, ExternalID, AvatarURL, ConnMode, SpatialStyle,
+	                            MaxVideoStreams, VideoForwardingStrategy, VideoCodec]
+	{
+		Connect(ConferenceName, UserName, ExternalID, AvatarURL, ConnMode, SpatialStyle, MaxVideoStreams,
+		        VideoForwardingStrategy, VideoCodec);
+	};
+
+	// Whatever the warm-up has prepared is only known once it finishes, so connecting waits for it
+	const FString SessionKey = MakeSessionKey(UserName, ExternalID, AvatarURL);
+	const FString ConferenceKey = MakeConferenceKey(ConferenceName, SpatialStyle, VideoCodec);
+	bool bIsSessionOpen;
+	bool bMustCloseSession;
+	bool bIsConferenceCreated;
+	TSharedPtr<conference_info> WarmConference;
+	{
+		FScopeLock Lock{&WarmUpLock};
+		if (bIsWarmingUp)
+		{
+			if (ConnectAfterWarmUp)
+			{
+				DLB_WARNING(OnConnectError, "Cannot connect - already waiting for connection warm-up to finish");
+				return;
+			}
+			DLB_UE_LOG("Waiting for connection warm-up to finish before connecting");
+			// A deferred reconnect attempt must still be treated as one when it is replayed, unless reconnecting
+			// was cancelled in the meantime
+			ConnectAfterWarmUp = [this, RepeatConnect, bIsReconnectAttempt = bIsAttemptingReconnect]
+			{
+				if (bIsReconnectAttempt && !bIsReconnecting)
+				{
+					return;
+				}
+				TGuardValue<bool> AttemptGuard{bIsAttemptingReconnect, bIsReconnectAttempt};
+				RepeatConnect();
+			};
+			return;
+		}
+
+		// The first reconnect attempt reuses the open session, the next ones start over in case it is broken
+		bIsSessionOpen = OpenSessionKey == SessionKey && !(bIsAttemptingReconnect && ReconnectAttempt > 1);
+		bMustCloseSession = !bIsSessionOpen && !OpenSessionKey.IsEmpty();
+		bIsConferenceCreated = bIsSessionOpen && WarmConferenceKey == ConferenceKey;
+		WarmConference = MoveTemp(WarmConferenceInfo);
+		WarmConferenceKey.Reset(); // a created conference can only be joined once
+		WarmConferenceInfo.Reset();
+	}
+
+	ConnectionTimer->Start();
+	if (bIsSessionOpen)
+	{
+		ConnectionTimer->Record(FConnectionTimer::EStage::SessionOpen);
+	}
+	if (bIsConferenceCreated)
+	{
+		ConnectionTimer->Record(FConnectionTimer::EStage::ConferenceCreate);
+	}
 
 	ConnectionMode = ConnMode;
 	SpatialAudioStyle = SpatialStyle;
-	DLB_UE_LOG("Connecting to conference %s with user name \"%s\" (%s, %s, %s/%d, %s)", *ConferenceName, *UserName,
+	DLB_UE_LOG("Connecting to conference %s with user name \"%s\" (%s, %s, %s/%d, %s)%s", *ConferenceName, *UserName,
 	           *UEnum::GetValueAsString(ConnectionMode), *UEnum::GetValueAsString(SpatialAudioStyle),
 	           *UEnum::GetValueAsString(VideoForwardingStrategy), MaxVideoStreams,
-	           *UEnum::GetValueAsString(VideoCodec));
+	           *UEnum::GetValueAsString(VideoCodec),
+	           bIsConferenceCreated ? TEXT(" using warmed up conference")
+	           : bIsSessionOpen     ? TEXT(" using warmed up session")
+	                                : TEXT(""));
+	// Participants are kept while reconnecting and reconciled once the conference is joined again
+	if (!bIsAttemptingReconnect)
+	{
+		EmptyRemoteParticipants();
+		bIsDisconnectRequested = false;
+		ReconnectCommand = RepeatConnect;
+	}
 
-	services::session::user_info UserInfo{};
-	UserInfo.name = ToStdString(UserName);
-	UserInfo.externalId = ToStdString(ExternalID);
-	UserInfo.avatarUrl = ToStdString(AvatarURL);
-	EmptyRemoteParticipants();
+#if DOLBYIO_WITH_FAKE_BACKEND
+	if (FakeBackend)
+	{
+		return FakeBackend->Connect(UserName, bIsSessionOpen, bIsConferenceCreated);
+	}
+#endif
 
-	Sdk->session()
-	    .open(MoveTemp(UserInfo))
-	    .then(
-	        [this, ConferenceName = ToStdString(ConferenceName),
-	         VideoCodec = ToSdkVideoCodec(VideoCodec)](services::session::user_info&& User)
-	        {
-		        LocalParticipantID = ToFString(User.participant_id.value_or(""));
+	const auto OpenSession = [this, UserInfo = MakeUserInfo(UserName, ExternalID, AvatarURL)]
+	{
+		return Sdk->session().open(services::session::user_info{UserInfo});
+	};
+	const auto CreateConference = [this, ConferenceName = ToStdString(ConferenceName),
+	                               VideoCodec = ToSdkVideoCodec(VideoCodec)]
+	{
+		conference::conference_options Options{};
+		Options.alias = ConferenceName;
+		Options.params.spatial_audio_style = ToSdkSpatialAudioStyle(SpatialAudioStyle);
+		Options.params.video_codec = VideoCodec;
+		return Sdk->conference().create(Options);
+	};
+	const auto OnSessionOpened = [this, SessionKey, CreateConference](services::session::user_info&& User)
+	{
+		DLB_TRACE_CPU_SCOPE(Connect_SessionOpened);
+		ConnectionTimer->Record(FConnectionTimer::EStage::SessionOpen);
+		LocalParticipantID = ToFString(User.participant_id.value_or(""));
+		{
+			FScopeLock Lock{&WarmUpLock};
+			OpenSessionKey = SessionKey;
+		}
+		return CreateConference();
+	};
+	const auto JoinConference = [this, MaxVideoStreams, VideoForwardingStrategy](conference_info&& ConferenceInfo)
+	{
+		DLB_TRACE_CPU_SCOPE(Connect_ConferenceCreated);
+		ConnectionTimer->Record(FConnectionTimer::EStage::ConferenceCreate);
+		ConferenceID = ToFString(ConferenceInfo.id);
+		if (ConnectionMode == EDolbyIOConnectionMode::Active)
+		{
+			conference::join_options Options{};
+			Options.constraints.audio = true;
+			Options.constraints.video = bIsVideoEnabled;
+			Options.connection.spatial_audio = IsSpatialAudio();
+			Options.connection.max_video_forwarding = MaxVideoStreams;
+			Options.connection.forwarding_strategy =
+			    VideoForwardingStrategy == EDolbyIOVideoForwardingStrategy::LastSpeaker
+			        ? video_forwarding_strategy::last_speaker
+			        : video_forwarding_strategy::closest_user;
+			return Sdk->conference().join(ConferenceInfo, Options);
+		}
+		else
+		{
+			conference::listen_options Options{};
+			Options.connection.spatial_audio = IsSpatialAudio();
+			Options.type = ConnectionMode == EDolbyIOConnectionMode::ListenerRegular ? listen_mode::regular
+			                                                                         : listen_mode::rts_mixed;
+			return Sdk->conference().listen(ConferenceInfo, Options);
+		}
+	};
+	const auto OnJoined = [this](conference_info&& ConferenceInfo)
+	{
+		DLB_TRACE_CPU_SCOPE(Connect_Joined);
+		DLB_UE_LOG("Connected to conference ID %s with user ID %s", *ConferenceID, *LocalParticipantID);
+		SetSpatialEnvironment();
+		ToggleInputMute();
+		ToggleOutputMute();
+	};
+	const auto OnError = [this](std::exception_ptr&& ExcPtr) { FailConnect(MoveTemp(ExcPtr)); };
+
+	// Only the stages which were not completed by WarmUpConnection are performed
+	if (bIsConferenceCreated && WarmConference)
+	{
+		JoinConference(MoveTemp(*WarmConference)).then(OnJoined).on_error(OnError);
+	}
+	else if (bIsSessionOpen)
+	{
+		CreateConference().then(JoinConference).then(OnJoined).on_error(OnError);
+	}
+	else if (bMustCloseSession)
+	{
+		DLB_UE_LOG("Closing previously opened session");
+		Sdk->session()
+		    .close()
+		    .then(OpenSession)
+		    .then(OnSessionOpened)
+		    .then(JoinConference)
+		    .then(OnJoined)
+		    .on_error(OnError);
+	}
+	else
+	{
+		OpenSession().then(OnSessionOpened).then(JoinConference).then(OnJoined).on_error(OnError);
+	}
+}
 
-		        conference::conference_options Options{};
-		        Options.alias = ConferenceName;
-		        Options.params.spatial_audio_style = ToSdkSpatialAudioStyle(SpatialAudioStyle);
-		        Options.params.video_codec = VideoCodec;
-		        return Sdk->conference().create(Options);
-	        })
-	    .then(
-	        [this, MaxVideoStreams, VideoForwardingStrategy](conference_info&& ConferenceInfo)
-	        {
-		        ConferenceID = ToFString(ConferenceInfo.id);
-		        if (ConnectionMode == EDolbyIOConnectionMode::Active)
-		        {
-			        conference::join_options Options{};
-			        Options.constraints.audio = true;
-			        Options.constraints.video = bIsVideoEnabled;
-			        Options.connection.spatial_audio = IsSpatialAudio();
-			        Options.connection.max_video_forwarding = MaxVideoStreams;
-			        Options.connection.forwarding_strategy =
-			            VideoForwardingStrategy == EDolbyIOVideoForwardingStrategy::LastSpeaker
-			                ? video_forwarding_strategy::last_speaker
-			                : video_forwarding_strategy::closest_user;
-			        return Sdk->conference().join(ConferenceInfo, Options);
-		        }
-		        else
-		        {
-			        conference::listen_options Options{};
-			        Options.connection.spatial_audio = IsSpatialAudio();
-			        Options.type = ConnectionMode == EDolbyIOConnectionMode::ListenerRegular ? listen_mode::regular
-			                                                                                 : listen_mode::rts_mixed;
-			        return Sdk->conference().listen(ConferenceInfo, Options);
-		        }
-	        })
-	    .then(
-	        [this](conference_info&& ConferenceInfo)
-	        {
-		        DLB_UE_LOG("Connected to conference ID %s with user ID %s", *ConferenceID, *LocalParticipantID);
-		        SetSpatialEnvironment();
-		        ToggleInputMute();
-		        ToggleOutputMute();
-	        })
-	    .on_error(DLB_ERROR_HANDLER(OnConnectError));
+void UDolbyIOSubsystem::FailConnect(std::exception_ptr&& ExcPtr)
+{
+	if (!bIsReconnecting)
+	{
+		return DLB_ERROR_HANDLER(OnConnectError)(MoveTemp(ExcPtr));
+	}
+
+	DLB_ERROR_HANDLER_NO_DELEGATE(MoveTemp(ExcPtr));
+	FEventQueue::Enqueue(*this, [this] { ScheduleReconnect(); });
 }
 
 void UDolbyIOSubsystem::DemoConference()
@@ -98,64 +399,287 @@ void UDolbyIOSubsystem::DemoConference()
 		return;
 	}
 
-	DLB_UE_LOG("Connecting to demo conference");
+	// Like Connect, wait for the warm-up and then reuse its session if it was opened without user information, or
+	// close it otherwise. The demo conference is created by the backend, so a warmed up conference is not used.
+	const FString SessionKey = MakeSessionKey("", "", "");
+	bool bIsSessionOpen;
+	bool bMustCloseSession;
+	{
+		FScopeLock Lock{&WarmUpLock};
+		if (bIsWarmingUp)
+		{
+			if (ConnectAfterWarmUp)
+			{
+				DLB_WARNING(OnDemoConferenceError,
+				            "Cannot connect to demo conference - already waiting for connection warm-up to finish");
+				return;
+			}
+			DLB_UE_LOG("Waiting for connection warm-up to finish before connecting to demo conference");
+			ConnectAfterWarmUp = [this] { DemoConference(); };
+			return;
+		}
+
+		bIsSessionOpen = OpenSessionKey == SessionKey;
+		bMustCloseSession = !bIsSessionOpen && !OpenSessionKey.IsEmpty();
+		WarmConferenceKey.Reset();
+		WarmConferenceInfo.Reset();
+	}
+
+	DLB_UE_LOG("Connecting to demo conference%s", bIsSessionOpen ? TEXT(" using warmed up session") : TEXT(""));
 	ConnectionMode = EDolbyIOConnectionMode::Active;
 	SpatialAudioStyle = EDolbyIOSpatialAudioStyle::Shared;
 	EmptyRemoteParticipants();
+	bIsDisconnectRequested = false;
+	ReconnectCommand = nullptr;
+	ConnectionTimer->Start();
+	if (bIsSessionOpen)
+	{
+		ConnectionTimer->Record(FConnectionTimer::EStage::SessionOpen);
+	}
 
-	Sdk->session()
-	    .open({})
-	    .then(
-	        [this](services::session::user_info&& User)
-	        {
-		        LocalParticipantID = ToFString(User.participant_id.value_or(""));
-		        return Sdk->conference().demo(ToSdkSpatialAudioStyle(SpatialAudioStyle));
-	        })
-	    .then(
-	        [this](conference_info&& ConferenceInfo)
-	        {
-		        DLB_UE_LOG("Connected to conference ID %s", *ToFString(ConferenceInfo.id));
-		        SetSpatialEnvironment();
-		        ToggleInputMute();
-		        ToggleOutputMute();
-	        })
-	    .on_error(DLB_ERROR_HANDLER(OnDemoConferenceError));
+#if DOLBYIO_WITH_FAKE_BACKEND
+	if (FakeBackend)
+	{
+		return FakeBackend->Connect("", bIsSessionOpen);
+	}
+#endif
+
+	const auto OpenSession = [this] { return Sdk->session().open({}); };
+	const auto OnSessionOpened = [this, SessionKey](services::session::user_info&& User)
+	{
+		ConnectionTimer->Record(FConnectionTimer::EStage::SessionOpen);
+		LocalParticipantID = ToFString(User.participant_id.value_or(""));
+		{
+			FScopeLock Lock{&WarmUpLock};
+			OpenSessionKey = SessionKey;
+		}
+	};
+	const auto JoinDemo = [this] { return Sdk->conference().demo(ToSdkSpatialAudioStyle(SpatialAudioStyle)); };
+	const auto OnJoined = [this](conference_info&& ConferenceInfo)
+	{
+		DLB_UE_LOG("Connected to conference ID %s", *ToFString(ConferenceInfo.id));
+		SetSpatialEnvironment();
+		ToggleInputMute();
+		ToggleOutputMute();
+	};
+
+	if (bIsSessionOpen)
+	{
+		JoinDemo().then(OnJoined).on_error(DLB_ERROR_HANDLER(OnDemoConferenceError));
+	}
+	else if (bMustCloseSession)
+	{
+		DLB_UE_LOG("Closing previously opened session");
+		Sdk->session()
+		    .close()
+		    .then(OpenSession)
+		    .then(OnSessionOpened)
+		    .then(JoinDemo)
+		    .then(OnJoined)
+		    .on_error(DLB_ERROR_HANDLER(OnDemoConferenceError));
+	}
+	else
+	{
+		OpenSession()
+		    .then(OnSessionOpened)
+		    .then(JoinDemo)
+		    .then(OnJoined)
+		    .on_error(DLB_ERROR_HANDLER(OnDemoConferenceError));
+	}
 }
 
 void UDolbyIOSubsystem::Disconnect()
 {
+	if (bIsReconnecting)
+	{
+		DLB_UE_LOG("Cancelling reconnect");
+		bIsDisconnectRequested = true;
+		return StopReconnecting();
+	}
 	if (!IsConnected())
 	{
 		return;
 	}
 
 	DLB_UE_LOG("Disconnecting");
+	bIsDisconnectRequested = true;
+	SpatialCommandQueue->Discard();
+#if DOLBYIO_WITH_FAKE_BACKEND
+	if (FakeBackend)
+	{
+		return FakeBackend->Disconnect();
+	}
+#endif
 	Sdk->conference().leave().on_error(DLB_ERROR_HANDLER(OnDisconnectError));
 }
 
 void UDolbyIOSubsystem::UpdateStatus(conference_status Status)
 {
+	DLB_TRACE_CPU_SCOPE(UpdateStatus);
+
+	const conference_status PreviousStatus = ConferenceStatus;
 	ConferenceStatus = Status;
 	DLB_UE_LOG("Conference status: %s", *ToString(ConferenceStatus));
+	TRACE_BOOKMARK(TEXT("DolbyIO conference status: %s"), *ToString(ConferenceStatus));
 
 	switch (ConferenceStatus)
 	{
 		case conference_status::joined:
-			BroadcastEvent(OnConnected, LocalParticipantID, ConferenceID);
+			ConnectionTimer->Record(FConnectionTimer::EStage::Join);
+			if (bIsReconnecting)
+			{
+				FEventQueue::Enqueue(*this, [this] { FinishReconnecting(); });
+				break;
+			}
+			BroadcastEventWithNative(*this, OnConnected, OnConnectedNative, LocalParticipantID, ConferenceID);
 			break;
 		case conference_status::left:
 		case conference_status::error:
-			Sdk->session()
-			    .close()
-			    .then([this] { BroadcastEvent(OnDisconnected); })
-			    .on_error(DLB_ERROR_HANDLER(OnDisconnectError));
+			SpatialCommandQueue->Discard(); // values set for the conference just left
+			if (bIsReconnecting)
+			{
+				break; // failed attempts are retried by FailConnect
+			}
+			if (bIsAutomaticReconnectEnabled && !bIsDisconnectRequested && PreviousStatus == conference_status::joined)
+			{
+				DLB_UE_LOG("Connection lost, reconnecting");
+				bIsReconnecting = true;
+				FEventQueue::Enqueue(*this, [this] { StartReconnecting(); });
+				break;
+			}
+			CloseSession();
 			break;
 	}
 }
 
+void UDolbyIOSubsystem::CloseSession()
+{
+	{
+		FScopeLock Lock{&WarmUpLock};
+		OpenSessionKey.Reset();
+	}
+#if DOLBYIO_WITH_FAKE_BACKEND
+	if (FakeBackend)
+	{
+		return BroadcastEventWithNative(*this, OnDisconnected, OnDisconnectedNative);
+	}
+#endif
+	Sdk->session()
+	    .close()
+	    .then([this] { BroadcastEventWithNative(*this, OnDisconnected, OnDisconnectedNative); })
+	    .on_error(DLB_ERROR_HANDLER(OnDisconnectError));
+}
+
+FDolbyIOConnectionTimings UDolbyIOSubsystem::GetConnectionTimings() const
+{
+	return ConnectionTimer->GetTimings();
+}
+
+void UDolbyIOSubsystem::ReportConnectionTimings()
+{
+	FDolbyIOConnectionTimings Timings;
+	if (!ConnectionTimer->ShouldReport(Timings))
+	{
+		return;
+	}
+
+	DLB_UE_LOG("Connection timings: session open %.1f ms, conference create %.1f ms, join %.1f ms, first remote "
+	           "participant %.1f ms, first remote video frame %.1f ms, first audio level %.1f ms",
+	           Timings.SessionOpenMs, Timings.ConferenceCreateMs, Timings.JoinMs, Timings.FirstRemoteParticipantMs,
+	           Timings.FirstRemoteVideoFrameMs, Timings.FirstAudioLevelMs);
+	SET_FLOAT_STAT(STAT_DolbyIO_JoinTime, Timings.JoinMs);
+	BroadcastEventWithNative(*this, OnConnectionTimings, OnConnectionTimingsNative, Timings);
+}
+
+void UDolbyIOSubsystem::SetAutomaticReconnect(bool bIsEnabled)
+{
+	DLB_UE_LOG("%s automatic reconnect", bIsEnabled ? TEXT("Enabling") : TEXT("Disabling"));
+	bIsAutomaticReconnectEnabled = bIsEnabled;
+}
+
+void UDolbyIOSubsystem::StartReconnecting()
+{
+	if (!ReconnectCommand)
+	{
+		DLB_UE_LOG_BASE(Warning, "Cannot reconnect - not connected using the Connect function");
+		return StopReconnecting();
+	}
+
+	{
+		FScopeLock Lock{&RemoteParticipantsLock};
+		RemoteParticipants.GetKeys(UnconfirmedParticipantIDs);
+	}
+	ReconnectAttempt = 0;
+	ReconnectStartTime = FPlatformTime::Seconds();
+	ScheduleReconnect();
+}
+
+void UDolbyIOSubsystem::ScheduleReconnect()
+{
+	if (!bIsReconnecting)
+	{
+		return; // cancelled in the meantime
+	}
+	if (ReconnectAttempt >= CVarReconnectMaxAttempts.GetValueOnGameThread())
+	{
+		DLB_UE_LOG_BASE(Warning, "Giving up reconnecting after %d attempts", ReconnectAttempt);
+		return StopReconnecting();
+	}
+
+	// Exponential backoff
+	const float DelayMs = FMath::Min(CVarReconnectInitialDelayMs.GetValueOnGameThread() * (1 << ReconnectAttempt),
+	                                 CVarReconnectMaxDelayMs.GetValueOnGameThread());
+	++ReconnectAttempt;
+	NextReconnectTime = FPlatformTime::Seconds() + DelayMs / 1000.0;
+	DLB_UE_LOG("Reconnect attempt %d in %.0f ms", ReconnectAttempt, DelayMs);
+	BroadcastEventWithNative(*this, OnReconnecting, OnReconnectingNative, ReconnectAttempt, DelayMs / 1000.0f);
+}
+
+void UDolbyIOSubsystem::UpdateReconnect()
+{
+	const double Now = FPlatformTime::Seconds();
+	if (NextReconnectTime > 0.0 && Now >= NextReconnectTime)
+	{
+		NextReconnectTime = 0.0;
+		bIsAttemptingReconnect = true;
+		ReconnectCommand();
+		bIsAttemptingReconnect = false;
+	}
+	if (ReconnectGraceExpiryTime > 0.0 && Now >= ReconnectGraceExpiryTime)
+	{
+		ReconnectGraceExpiryTime = 0.0;
+		RemoveParkedVideoTracks();
+		RemoveUnconfirmedParticipants();
+	}
+}
+
+void UDolbyIOSubsystem::StopReconnecting()
+{
+	bIsReconnecting = false;
+	NextReconnectTime = 0.0;
+	RemoveParkedVideoTracks();
+	{
+		FScopeLock Lock{&RemoteParticipantsLock};
+		UnconfirmedParticipantIDs.Reset();
+	}
+	CloseSession();
+}
+
+void UDolbyIOSubsystem::FinishReconnecting()
+{
+	bIsReconnecting = false;
+	const double Now = FPlatformTime::Seconds();
+	const float Duration = Now - ReconnectStartTime;
+	DLB_UE_LOG("Reconnected after %d attempts in %.2f s", ReconnectAttempt, Duration);
+	BroadcastEventWithNative(*this, OnReconnected, OnReconnectedNative, ReconnectAttempt, Duration);
+
+	// Video tracks and participants which are not added again by then are gone for good
+	ReconnectGraceExpiryTime = Now + ReconnectGraceSeconds;
+}
+
 bool UDolbyIOSubsystem::CanConnect(const FDolbyIOOnErrorDelegate& OnError) const
 {
-	if (!Sdk)
+	if (!Sdk && !FakeBackend)
 	{
 		DLB_WARNING(OnError, "Cannot connect - not initialized");
 		return false;
@@ -180,8 +704,41 @@ bool UDolbyIOSubsystem::IsConnectedAsActive() const
 
 void UDolbyIOSubsystem::EmptyRemoteParticipants()
 {
+	// A new connection ends the grace period of a previous reconnect
+	ReconnectGraceExpiryTime = 0.0;
+	RemoveParkedVideoTracks();
+
 	FScopeLock Lock{&RemoteParticipantsLock};
 	RemoteParticipants.Empty();
+	ActiveSpeakerIDs.Reset();
+	UnconfirmedParticipantIDs.Reset();
+	SET_DWORD_STAT(STAT_DolbyIO_RemoteParticipants, 0);
+	AudioLevelTable->Reset();
+}
+
+void UDolbyIOSubsystem::RemoveUnconfirmedParticipants()
+{
+	TArray<FDolbyIOParticipantInfo> LeftParticipants;
+	{
+		FScopeLock Lock{&RemoteParticipantsLock};
+		for (const FIDHandle ParticipantID : UnconfirmedParticipantIDs)
+		{
+			FDolbyIOParticipantInfo* Info = RemoteParticipants.Find(ParticipantID);
+			if (Info && Info->Status != EDolbyIOParticipantStatus::Left &&
+			    Info->Status != EDolbyIOParticipantStatus::Kicked)
+			{
+				Info->Status = EDolbyIOParticipantStatus::Left;
+				LeftParticipants.Add(*Info);
+			}
+		}
+		UnconfirmedParticipantIDs.Reset();
+	}
+
+	for (const FDolbyIOParticipantInfo& Info : LeftParticipants)
+	{
+		DLB_UE_LOG("Participant not added again after reconnecting: UserID=%s Name=%s", *Info.UserID, *Info.Name);
+		BroadcastParticipantUpdated(Info);
+	}
 }
 
 TArray<FDolbyIOParticipantInfo> UDolbyIOSubsystem::GetParticipants()
@@ -197,7 +754,7 @@ TArray<FDolbyIOParticipantInfo> UDolbyIOSubsystem::GetParticipants()
 
 void UDolbyIOSubsystem::UpdateUserMetadata(const FString& UserName, const FString& AvatarURL)
 {
-	if (!IsConnected())
+	if (!Sdk || !IsConnected())
 	{
 		return;
 	}
@@ -211,7 +768,7 @@ void UDolbyIOSubsystem::UpdateUserMetadata(const FString& UserName, const FStrin
 
 void UDolbyIOSubsystem::SendMessage(const FString& Message, const TArray<FString>& ParticipantIDs)
 {
-	if (!IsConnected())
+	if (!Sdk || !IsConnected())
 	{
 		DLB_WARNING(OnSendMessageError, "Cannot send message - not connected");
 		return;
@@ -231,64 +788,105 @@ void UDolbyIOSubsystem::SendMessage(const FString& Message, const TArray<FString
 
 void UDolbyIOSubsystem::Handle(const remote_participant_added& Event)
 {
+	DLB_TRACE_CPU_SCOPE(Handle_remote_participant_added);
+
 	if (!Event.participant.status)
 	{
 		return;
 	}
 
+	ConnectionTimer->Record(FConnectionTimer::EStage::FirstRemoteParticipant);
+	const FIDHandle ParticipantID = FIDTable::Intern(Event.participant.user_id);
 	const FDolbyIOParticipantInfo Info = ToFDolbyIOParticipantInfo(Event.participant);
 	DLB_UE_LOG("Participant status added: UserID=%s Name=%s ExternalID=%s Status=%s", *Info.UserID, *Info.Name,
 	           *Info.ExternalID, *ToString(*Event.participant.status));
+	TOptional<EDolbyIOParticipantStatus> PreviousStatus;
 	{
 		FScopeLock Lock{&RemoteParticipantsLock};
-		RemoteParticipants.Emplace(Info.UserID, Info);
+		if (UnconfirmedParticipantIDs.Remove(ParticipantID))
+		{
+			if (const FDolbyIOParticipantInfo* PreviousInfo = RemoteParticipants.Find(ParticipantID))
+			{
+				PreviousStatus = PreviousInfo->Status;
+			}
+		}
+		RemoteParticipants.Emplace(ParticipantID, Info);
+		SET_DWORD_STAT(STAT_DolbyIO_RemoteParticipants, RemoteParticipants.Num());
 	}
 
-	BroadcastEvent(OnParticipantAdded, Info.Status, Info);
-	BroadcastRemoteParticipantConnectedIfNecessary(Info);
-	ProcessBufferedVideoTracks(Info.UserID);
+	// Participants known before reconnecting were already added, so they are only updated if their status changed
+	if (!PreviousStatus)
+	{
+		BroadcastEventWithNative(*this, OnParticipantAdded, OnParticipantAddedNative, Info.Status, Info);
+		BroadcastRemoteParticipantConnectedIfNecessary(Info);
+	}
+	else if (*PreviousStatus != Info.Status)
+	{
+		BroadcastParticipantUpdated(Info);
+	}
+	ProcessBufferedVideoTracks(ParticipantID);
 }
 
 void UDolbyIOSubsystem::Handle(const remote_participant_updated& Event)
 {
+	DLB_TRACE_CPU_SCOPE(Handle_remote_participant_updated);
+
 	if (!Event.participant.status)
 	{
 		return;
 	}
 
+	const FIDHandle ParticipantID = FIDTable::Intern(Event.participant.user_id);
 	const FDolbyIOParticipantInfo Info = ToFDolbyIOParticipantInfo(Event.participant);
 	DLB_UE_LOG("Participant status updated: UserID=%s Name=%s ExternalID=%s Status=%s", *Info.UserID, *Info.Name,
 	           *Info.ExternalID, *ToString(*Event.participant.status));
 	{
 		FScopeLock Lock{&RemoteParticipantsLock};
-		RemoteParticipants.FindOrAdd(Info.UserID) = Info;
+		UnconfirmedParticipantIDs.Remove(ParticipantID);
+		RemoteParticipants.FindOrAdd(ParticipantID) = Info;
+		SET_DWORD_STAT(STAT_DolbyIO_RemoteParticipants, RemoteParticipants.Num());
 	}
 
-	BroadcastEvent(OnParticipantUpdated, Info.Status, Info);
-	BroadcastRemoteParticipantConnectedIfNecessary(Info);
-	BroadcastRemoteParticipantDisconnectedIfNecessary(Info);
+	BroadcastParticipantUpdated(Info);
 }
 
 void UDolbyIOSubsystem::BroadcastRemoteParticipantConnectedIfNecessary(const FDolbyIOParticipantInfo& ParticipantInfo)
 {
 	if (ParticipantInfo.Status == EDolbyIOParticipantStatus::OnAir)
 	{
-		BroadcastEvent(OnRemoteParticipantConnected, ParticipantInfo);
+		BroadcastEventWithNative(*this, OnRemoteParticipantConnected, OnRemoteParticipantConnectedNative,
+		                         ParticipantInfo);
 	}
 }
 
-void UDolbyIOSubsystem::BroadcastRemoteParticipantDisconnectedIfNecessary(
-    const FDolbyIOParticipantInfo& ParticipantInfo)
+// The connected and disconnected events are broadcast from the same coalesced event as the update, so that they are
+// replaced along with it instead of keeping a newer update from being coalesced.
+void UDolbyIOSubsystem::BroadcastParticipantUpdated(const FDolbyIOParticipantInfo& ParticipantInfo)
 {
-	if (ParticipantInfo.Status == EDolbyIOParticipantStatus::Left ||
-	    ParticipantInfo.Status == EDolbyIOParticipantStatus::Kicked)
-	{
-		BroadcastEvent(OnRemoteParticipantDisconnected, ParticipantInfo);
-	}
+	FEventQueue::EnqueueCoalesced(
+	    *this, &OnParticipantUpdated, ParticipantInfo.UserID,
+	    [this, ParticipantInfo]
+	    {
+		    OnParticipantUpdated.Broadcast(ParticipantInfo.Status, ParticipantInfo);
+		    OnParticipantUpdatedNative.Broadcast(ParticipantInfo.Status, ParticipantInfo);
+		    if (ParticipantInfo.Status == EDolbyIOParticipantStatus::OnAir)
+		    {
+			    OnRemoteParticipantConnected.Broadcast(ParticipantInfo);
+			    OnRemoteParticipantConnectedNative.Broadcast(ParticipantInfo);
+		    }
+		    else if (ParticipantInfo.Status == EDolbyIOParticipantStatus::Left ||
+		             ParticipantInfo.Status == EDolbyIOParticipantStatus::Kicked)
+		    {
+			    OnRemoteParticipantDisconnected.Broadcast(ParticipantInfo);
+			    OnRemoteParticipantDisconnectedNative.Broadcast(ParticipantInfo);
+		    }
+	    });
 }
 
 void UDolbyIOSubsystem::Handle(const local_participant_updated& Event)
 {
+	DLB_TRACE_CPU_SCOPE(Handle_local_participant_updated);
+
 	if (!Event.participant.status)
 	{
 		return;
@@ -298,21 +896,23 @@ void UDolbyIOSubsystem::Handle(const local_participant_updated& Event)
 	DLB_UE_LOG("Local participant status updated: UserID=%s Name=%s ExternalID=%s Status=%s", *Info.UserID, *Info.Name,
 	           *Info.ExternalID, *ToString(*Event.participant.status));
 
-	BroadcastEvent(OnLocalParticipantUpdated, Info.Status, Info);
+	BroadcastEventWithNative(*this, OnLocalParticipantUpdated, OnLocalParticipantUpdatedNative, Info.Status, Info);
 }
 
 void UDolbyIOSubsystem::Handle(const conference_message_received& Event)
 {
+	DLB_TRACE_CPU_SCOPE(Handle_conference_message_received);
+
 	const FString Message = ToFString(Event.message);
 	FScopeLock Lock{&RemoteParticipantsLock};
-	if (const FDolbyIOParticipantInfo* Sender = RemoteParticipants.Find(ToFString(Event.user_id)))
+	if (const FDolbyIOParticipantInfo* Sender = RemoteParticipants.Find(FIDTable::Intern(Event.user_id)))
 	{
 		DLB_UE_LOG("Message received: \"%s\" from %s (%s)", *Message, *Sender->Name, *Sender->UserID);
-		BroadcastEvent(OnMessageReceived, Message, *Sender);
+		BroadcastEventWithNative(*this, OnMessageReceived, OnMessageReceivedNative, Message, *Sender);
 	}
 	else
 	{
 		DLB_UE_LOG("Message received: %s from unknown participant", *Message);
-		BroadcastEvent(OnMessageReceived, Message, FDolbyIOParticipantInfo{});
+		BroadcastEventWithNative(*this, OnMessageReceived, OnMessageReceivedNative, Message, FDolbyIOParticipantInfo{});
 	}
 }
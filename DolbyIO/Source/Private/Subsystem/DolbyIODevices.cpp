@@ -7,6 +7,7 @@
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOTrace.h"
 
 using namespace dolbyio::comms;
 using namespace DolbyIO;
@@ -77,7 +78,8 @@ namespace DolbyIO
 					        Devices.Add(ToFDolbyIOAudioDevice(Device));
 				        }
 			        }
-			        BroadcastEvent(Subsystem.OnAudioInputDevicesReceived, Devices);
+			        BroadcastEventWithNative(Subsystem, Subsystem.OnAudioInputDevicesReceived,
+			                                 Subsystem.OnAudioInputDevicesReceivedNative, Devices);
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetAudioInputDevicesError));
 	}
@@ -98,7 +100,8 @@ namespace DolbyIO
 					        Devices.Add(ToFDolbyIOAudioDevice(Device));
 				        }
 			        }
-			        BroadcastEvent(Subsystem.OnAudioOutputDevicesReceived, Devices);
+			        BroadcastEventWithNative(Subsystem, Subsystem.OnAudioOutputDevicesReceived,
+			                                 Subsystem.OnAudioOutputDevicesReceivedNative, Devices);
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetAudioOutputDevicesError));
 	}
@@ -113,13 +116,15 @@ namespace DolbyIO
 			        if (!Device)
 			        {
 				        DLB_UE_LOG("Got current audio input device - none");
-				        BroadcastEvent(Subsystem.OnCurrentAudioInputDeviceReceived, bIsDeviceNone,
-				                       FDolbyIOAudioDevice{});
+				        BroadcastEventWithNative(Subsystem, Subsystem.OnCurrentAudioInputDeviceReceived,
+				                                 Subsystem.OnCurrentAudioInputDeviceReceivedNative, bIsDeviceNone,
+				                                 FDolbyIOAudioDevice{});
 				        return;
 			        }
 			        DLB_UE_LOG("Got current audio input device - %s", *ToString(*Device));
-			        BroadcastEvent(Subsystem.OnCurrentAudioInputDeviceReceived, !bIsDeviceNone,
-			                       ToFDolbyIOAudioDevice(*Device));
+			        BroadcastEventWithNative(Subsystem, Subsystem.OnCurrentAudioInputDeviceReceived,
+			                                 Subsystem.OnCurrentAudioInputDeviceReceivedNative, !bIsDeviceNone,
+			                                 ToFDolbyIOAudioDevice(*Device));
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetCurrentAudioInputDeviceError));
 	}
@@ -134,13 +139,15 @@ namespace DolbyIO
 			        if (!Device)
 			        {
 				        DLB_UE_LOG("Got current audio output device - none");
-				        BroadcastEvent(Subsystem.OnCurrentAudioOutputDeviceReceived, bIsDeviceNone,
-				                       FDolbyIOAudioDevice{});
+				        BroadcastEventWithNative(Subsystem, Subsystem.OnCurrentAudioOutputDeviceReceived,
+				                                 Subsystem.OnCurrentAudioOutputDeviceReceivedNative, bIsDeviceNone,
+				                                 FDolbyIOAudioDevice{});
 				        return;
 			        }
 			        DLB_UE_LOG("Got current audio output device - %s", *ToString(*Device));
-			        BroadcastEvent(Subsystem.OnCurrentAudioOutputDeviceReceived, !bIsDeviceNone,
-			                       ToFDolbyIOAudioDevice(*Device));
+			        BroadcastEventWithNative(Subsystem, Subsystem.OnCurrentAudioOutputDeviceReceived,
+			                                 Subsystem.OnCurrentAudioOutputDeviceReceivedNative, !bIsDeviceNone,
+			                                 ToFDolbyIOAudioDevice(*Device));
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetCurrentAudioOutputDeviceError));
 	}
@@ -198,7 +205,8 @@ namespace DolbyIO
 				                   *ToFString(Device.unique_id));
 				        Devices.Add(ToFDolbyIOVideoDevice(Device));
 			        }
-			        BroadcastEvent(Subsystem.OnVideoDevicesReceived, Devices);
+			        BroadcastEventWithNative(Subsystem, Subsystem.OnVideoDevicesReceived,
+			                                 Subsystem.OnVideoDevicesReceivedNative, Devices);
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetVideoDevicesError));
 	}
@@ -213,12 +221,15 @@ namespace DolbyIO
 			        if (!Device)
 			        {
 				        DLB_UE_LOG("Got current video device - none");
-				        BroadcastEvent(Subsystem.OnCurrentVideoDeviceReceived, bIsDeviceNone, FDolbyIOVideoDevice{});
+				        BroadcastEventWithNative(Subsystem, Subsystem.OnCurrentVideoDeviceReceived,
+				                                 Subsystem.OnCurrentVideoDeviceReceivedNative, bIsDeviceNone,
+				                                 FDolbyIOVideoDevice{});
 				        return;
 			        }
 			        DLB_UE_LOG("Got current video device - %s", *ToString(*Device));
-			        BroadcastEvent(Subsystem.OnCurrentVideoDeviceReceived, !bIsDeviceNone,
-			                       ToFDolbyIOVideoDevice(*Device));
+			        BroadcastEventWithNative(Subsystem, Subsystem.OnCurrentVideoDeviceReceived,
+			                                 Subsystem.OnCurrentVideoDeviceReceivedNative, !bIsDeviceNone,
+			                                 ToFDolbyIOVideoDevice(*Device));
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetCurrentVideoDeviceError));
 	}
@@ -226,15 +237,19 @@ namespace DolbyIO
 
 void UDolbyIOSubsystem::Handle(const audio_device_changed& Event)
 {
+	DLB_TRACE_CPU_SCOPE(Handle_audio_device_changed);
+
 	using namespace DolbyIO;
 
 	if (!Event.device)
 	{
 		DLB_UE_LOG("Audio device changed for direction: %s to no device", *ToString(Event.utilized_direction));
 		if (Event.utilized_direction == audio_device::direction::input)
-			BroadcastEvent(OnCurrentAudioInputDeviceChanged, bIsDeviceNone, FDolbyIOAudioDevice{});
+			BroadcastEventWithNative(*this, OnCurrentAudioInputDeviceChanged, OnCurrentAudioInputDeviceChangedNative,
+			                         bIsDeviceNone, FDolbyIOAudioDevice{});
 		else
-			BroadcastEvent(OnCurrentAudioOutputDeviceChanged, bIsDeviceNone, FDolbyIOAudioDevice{});
+			BroadcastEventWithNative(*this, OnCurrentAudioOutputDeviceChanged, OnCurrentAudioOutputDeviceChangedNative,
+			                         bIsDeviceNone, FDolbyIOAudioDevice{});
 		return;
 	}
 	Sdk->device_management()
@@ -248,11 +263,13 @@ void UDolbyIOSubsystem::Handle(const audio_device_changed& Event)
 				        DLB_UE_LOG("Audio device changed for direction: %s to device - %s",
 				                   *ToString(Event.utilized_direction), *ToString(Device));
 				        if (Event.utilized_direction == audio_device::direction::input)
-					        BroadcastEvent(OnCurrentAudioInputDeviceChanged, !bIsDeviceNone,
-					                       ToFDolbyIOAudioDevice(Device));
+					        BroadcastEventWithNative(*this, OnCurrentAudioInputDeviceChanged,
+					                                 OnCurrentAudioInputDeviceChangedNative, !bIsDeviceNone,
+					                                 ToFDolbyIOAudioDevice(Device));
 				        else
-					        BroadcastEvent(OnCurrentAudioOutputDeviceChanged, !bIsDeviceNone,
-					                       ToFDolbyIOAudioDevice(Device));
+					        BroadcastEventWithNative(*this, OnCurrentAudioOutputDeviceChanged,
+					                                 OnCurrentAudioOutputDeviceChangedNative, !bIsDeviceNone,
+					                                 ToFDolbyIOAudioDevice(Device));
 				        return;
 			        }
 	        })
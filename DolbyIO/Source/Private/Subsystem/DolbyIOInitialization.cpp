@@ -2,20 +2,28 @@
 
 #include "DolbyIO.h"
 
+#include "Audio/DolbyIOAudioLevels.h"
 #include "DolbyIODevices.h"
+#include "Spatial/DolbyIOLocationInterpolator.h"
+#include "Spatial/DolbyIOSpatialCommandQueue.h"
 #include "Utils/DolbyIOBroadcastEvent.h"
+#include "Utils/DolbyIOConnectionTimer.h"
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOIDTable.h"
+#include "Utils/DolbyIOLLM.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
 #include "Video/DolbyIOVideoFrameHandler.h"
 #include "Video/DolbyIOVideoSink.h"
 
+#include "Async/Async.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/EngineVersion.h"
 #include "Misc/Paths.h"
-#include "TimerManager.h"
 
 using namespace dolbyio::comms;
 using namespace dolbyio::comms::plugin;
@@ -26,25 +34,44 @@ void UDolbyIOSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	Super::Initialize(Collection);
 
 	ConferenceStatus = conference_status::destroyed;
+	AudioLevelTable = MakeShared<FAudioLevels>();
+	ConnectionTimer = MakeShared<FConnectionTimer>();
+	LocationInterpolator = MakeShared<FLocationInterpolator>();
+	SpatialCommandQueue = MakeShared<FSpatialCommandQueue>(
+	    [this](FSpatialCommandQueue::ECommand Command, const FVector& Value, FIDHandle ParticipantID)
+	    {
+		    if (Command == FSpatialCommandQueue::ECommand::LocalPosition)
+		    {
+			    ForwardLocalPlayerLocation(Value, ParticipantID);
+		    }
+		    else
+		    {
+			    ForwardLocalPlayerDirection(Value);
+		    }
+	    });
 
 	{
 		FScopeLock Lock{&VideoSinksLock};
-		VideoSinks.Emplace(LocalCameraTrackID, std::make_shared<FVideoSink>(LocalCameraTrackID));
-		VideoSinks.Emplace(LocalScreenshareTrackID, std::make_shared<FVideoSink>(LocalScreenshareTrackID));
-		LocalCameraFrameHandler = std::make_shared<FVideoFrameHandler>(VideoSinks[LocalCameraTrackID]);
-		LocalScreenshareFrameHandler = std::make_shared<FVideoFrameHandler>(VideoSinks[LocalScreenshareTrackID]);
+		const std::shared_ptr<FVideoSink>& LocalCameraSink = VideoSinks.Emplace(
+		    FIDTable::Intern(FString{LocalCameraTrackID}), std::make_shared<FVideoSink>(LocalCameraTrackID));
+		const std::shared_ptr<FVideoSink>& LocalScreenshareSink = VideoSinks.Emplace(
+		    FIDTable::Intern(FString{LocalScreenshareTrackID}), std::make_shared<FVideoSink>(LocalScreenshareTrackID));
+		LocalCameraFrameHandler = std::make_shared<FVideoFrameHandler>(LocalCameraSink);
+		LocalScreenshareFrameHandler = std::make_shared<FVideoFrameHandler>(LocalScreenshareSink);
+		TRACE_COUNTER_SET(DolbyIO_VideoTracks, VideoSinks.Num());
+		SET_DWORD_STAT(STAT_DolbyIO_ActiveSinks, VideoSinks.Num());
 	}
 
-	FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
-	TimerManager.SetTimer(LocationTimerHandle, this, &UDolbyIOSubsystem::SetLocationUsingFirstPlayer, 0.1, true);
-	TimerManager.SetTimer(RotationTimerHandle, this, &UDolbyIOSubsystem::SetRotationUsingFirstPlayer, 0.01, true);
-
-	BroadcastEvent(OnTokenNeeded);
+	BroadcastEventWithNative(*this, OnTokenNeeded, OnTokenNeededNative);
 }
 
 void UDolbyIOSubsystem::Deinitialize()
 {
 	DLB_UE_LOG("Deinitializing");
+	bIsDeinitialized = true; // stops ticking and drops the events still queued for this subsystem
+
+	FakeBackend.Reset(); // stops the fake backend's thread, if any
+	SpatialCommandQueue->Shutdown(); // the queue itself is kept for SDK events still arriving
 
 	FScopeLock Lock{&VideoSinksLock};
 	for (auto& Sink : VideoSinks)
@@ -62,6 +89,8 @@ namespace
 	public:
 		void log(log_level Level, std::string_view Message) const override
 		{
+			DLB_TRACE_CPU_SCOPE(SdkLog);
+
 #define DLB_UE_LOG_SDK_BASE(Verbosity)                                           \
 	DLB_UE_LOG_BASE(Verbosity, "%s", *ToFText(std::string{Message}).ToString()); \
 	return;
@@ -132,6 +161,10 @@ void UDolbyIOSubsystem::SetToken(const FString& Token)
 
 void UDolbyIOSubsystem::Initialize(const FString& Token)
 {
+	DLB_TRACE_CPU_SCOPE(Initialize);
+	DLB_LLM_SCOPE(DolbyIO);
+
+	const double StartTime = FPlatformTime::Seconds();
 	try
 	{
 		Sdk = TSharedPtr<sdk>(sdk::create(ToStdString(Token),
@@ -139,7 +172,7 @@ void UDolbyIOSubsystem::Initialize(const FString& Token)
 		                                  {
 			                                  DLB_UE_LOG("Refresh token requested");
 			                                  RefreshTokenCb = TSharedPtr<refresh_token>(RefreshCb.release());
-			                                  BroadcastEvent(OnTokenNeeded);
+			                                  BroadcastEventWithNative(*this, OnTokenNeeded, OnTokenNeededNative);
 		                                  })
 		                          .release());
 	}
@@ -148,171 +181,309 @@ void UDolbyIOSubsystem::Initialize(const FString& Token)
 		DLB_ERROR_HANDLER(OnSetTokenError).HandleError();
 		return;
 	}
+	DLB_UE_LOG("SDK created after %.1f ms", (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
 	Devices = MakeShared<FDevices>(*this, Sdk->device_management());
 
-#define DLB_REGISTER_HANDLER(Service, Event) \
-	[this](event_handler_id) { return Sdk->Service().add_event_handler([this](const Event& Event) { Handle(Event); }); }
-
 	const FString ComponentName = "unreal-sdk";
 	const FString ComponentVersion = *IPluginManager::Get().FindPlugin("DolbyIO")->GetDescriptor().VersionName +
 	                                 FString{"_UE"} + FEngineVersion::Current().ToString(EVersionComponent::Minor);
 	DLB_UE_LOG("Registering component %s %s", *ComponentName, *ComponentVersion);
 	Sdk->register_component_version(ToStdString(ComponentName), ToStdString(ComponentVersion))
 	    .then(
-	        [this](sdk::component_data)
+	        [this, StartTime](sdk::component_data)
+	        {
+		        DLB_UE_LOG("Component registered after %.1f ms", (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		        RegisterEventHandlers(StartTime);
+	        })
+	    .on_error(DLB_ERROR_HANDLER(OnSetTokenError));
+}
+
+namespace
+{
+	// Shared by the concurrent registrations, which complete on SDK threads
+	struct FRegistrationState
+	{
+		std::atomic<int> PendingCount{1};
+		std::atomic<bool> bIsFailed{false};
+		const TCHAR* SlowestName = TEXT("none");
+		double SlowestTime = 0.0;
+		FCriticalSection Lock; // guards the slowest registration
+	};
+}
+
+void UDolbyIOSubsystem::RegisterEventHandlers(double StartTime)
+{
+	// The registrations do not depend on each other, so they are all issued at once instead of one after another and
+	// initialization finishes when the last one completes. The count starts at one so that it cannot drop to zero
+	// before every registration has been issued. Only the first failure is reported and initialization does not
+	// finish after it.
+	const TSharedRef<FRegistrationState, ESPMode::ThreadSafe> State =
+	    MakeShared<FRegistrationState, ESPMode::ThreadSafe>();
+	const double RegisterTime = FPlatformTime::Seconds();
+	const auto OnRegistered = [this, State, StartTime, RegisterTime](const TCHAR* Name)
+	{
+		if (Name)
+		{
+			const double Time = FPlatformTime::Seconds() - RegisterTime;
+			DLB_UE_LOG_BASE(Verbose, "Registered %s after %.1f ms", Name, Time * 1000.0);
+			FScopeLock Lock{&State->Lock};
+			if (Time > State->SlowestTime)
+			{
+				State->SlowestName = Name;
+				State->SlowestTime = Time;
+			}
+		}
+		if (--State->PendingCount || State->bIsFailed)
+		{
+			return;
+		}
+
+		utils::vfs_event::add_event_handler(*Sdk,
+		                                    [this](const utils::vfs_event& Event)
+		                                    {
+			                                    DLB_LLM_SCOPE(DolbyIO);
+			                                    Handle(Event);
+		                                    });
+
+		const double Now = FPlatformTime::Seconds();
+		DLB_UE_LOG("Initialized after %.1f ms (event handlers registered in %.1f ms, slowest %s in %.1f ms)",
+		           (Now - StartTime) * 1000.0, (Now - RegisterTime) * 1000.0, State->SlowestName,
+		           State->SlowestTime * 1000.0);
+		BroadcastEventWithNative(*this, OnInitialized, OnInitializedNative);
+	};
+	const auto OnFailed = [State, ErrorHandler = DLB_ERROR_HANDLER(OnSetTokenError),
+	                       LogOnlyHandler = DLB_ERROR_HANDLER_NO_DELEGATE](std::exception_ptr&& ExcPtr)
+	{
+		if (State->bIsFailed.exchange(true))
+		{
+			LogOnlyHandler(MoveTemp(ExcPtr));
+		}
+		else
+		{
+			ErrorHandler(MoveTemp(ExcPtr));
+		}
+	};
+
+#define DLB_REGISTER_HANDLER(Service, Event)                                    \
+	++State->PendingCount;                                                      \
+	Sdk->Service()                                                              \
+	    .add_event_handler(                                                     \
+	        [this](const Event& Event)                                          \
+	        {                                                                   \
+		        DLB_LLM_SCOPE(DolbyIO);                                         \
+		        Handle(Event);                                                  \
+	        })                                                                  \
+	    .then([OnRegistered](event_handler_id) { OnRegistered(TEXT(#Event)); }) \
+	    .on_error(OnFailed)
+
+	++State->PendingCount;
+	Sdk->conference()
+	    .add_event_handler(
+	        [this](const conference_status_updated& Event)
 	        {
-		        return Sdk->conference().add_event_handler([this](const conference_status_updated& Event)
-		                                                   { UpdateStatus(Event.status); });
+		        DLB_LLM_SCOPE(DolbyIO);
+		        UpdateStatus(Event.status);
 	        })
-	    .then(DLB_REGISTER_HANDLER(conference, active_speaker_changed))
-	    .then(DLB_REGISTER_HANDLER(device_management, audio_device_changed))
-	    .then(DLB_REGISTER_HANDLER(conference, audio_levels))
-	    .then(DLB_REGISTER_HANDLER(conference, conference_message_received))
-	    .then(DLB_REGISTER_HANDLER(conference, local_participant_updated))
-	    .then(DLB_REGISTER_HANDLER(conference, remote_participant_added))
-	    .then(DLB_REGISTER_HANDLER(conference, remote_participant_updated))
-	    .then(DLB_REGISTER_HANDLER(conference, remote_video_track_added))
-	    .then(DLB_REGISTER_HANDLER(conference, remote_video_track_removed))
-	    .then(DLB_REGISTER_HANDLER(device_management, screen_share_error))
-	    .then([this](event_handler_id)
+	    .then([OnRegistered](event_handler_id) { OnRegistered(TEXT("conference_status_updated")); })
+	    .on_error(OnFailed);
+	DLB_REGISTER_HANDLER(conference, active_speaker_changed);
+	DLB_REGISTER_HANDLER(device_management, audio_device_changed);
+	DLB_REGISTER_HANDLER(conference, audio_levels);
+	DLB_REGISTER_HANDLER(conference, conference_message_received);
+	DLB_REGISTER_HANDLER(conference, local_participant_updated);
+	DLB_REGISTER_HANDLER(conference, remote_participant_added);
+	DLB_REGISTER_HANDLER(conference, remote_participant_updated);
+	DLB_REGISTER_HANDLER(conference, remote_video_track_added);
+	DLB_REGISTER_HANDLER(conference, remote_video_track_removed);
+	DLB_REGISTER_HANDLER(device_management, screen_share_error);
+#undef DLB_REGISTER_HANDLER
+
 #if PLATFORM_WINDOWS
-	          { return Sdk->device_management().set_default_audio_device_policy(default_audio_device_policy::output); })
-	    .then([this]
+	++State->PendingCount;
+	Sdk->device_management()
+	    .set_default_audio_device_policy(default_audio_device_policy::output)
+	    .then([OnRegistered] { OnRegistered(TEXT("default_audio_device_policy")); })
+	    .on_error(OnFailed);
 #endif
 #if PLATFORM_WINDOWS | PLATFORM_MAC
-	          // keep this comment here to avoid wrong clang-formatting
-	          { return video_processor::create(*Sdk); })
-	    .then([this](std::shared_ptr<video_processor> VideoProcessorPtr)
-	          { VideoProcessor = std::move(VideoProcessorPtr); })
+	++State->PendingCount;
+	video_processor::create(*Sdk)
 	    .then(
-	        [this]
-#endif
+	        [this, OnRegistered](std::shared_ptr<video_processor> VideoProcessorPtr)
 	        {
-		        utils::vfs_event::add_event_handler(*Sdk, [this](const utils::vfs_event& Event) { Handle(Event); });
-
-		        DLB_UE_LOG("Initialized");
-		        BroadcastEvent(OnInitialized);
+		        VideoProcessor = std::move(VideoProcessorPtr);
+		        OnRegistered(TEXT("video_processor"));
 	        })
-	    .on_error(DLB_ERROR_HANDLER(OnSetTokenError));
+	    .on_error(OnFailed);
+#endif
+
+	OnRegistered(nullptr); // every registration has been issued
 }
 
-void UDolbyIOObserver::InitializeComponent()
+namespace
 {
-	if (UWorld* World = GetWorld())
+	UDolbyIOSubsystem* GetDolbyIOSubsystem(const UActorComponent& Component)
 	{
-		if (UGameInstance* GameInstance = World->GetGameInstance())
+		if (UWorld* World = Component.GetWorld())
 		{
-			if (UDolbyIOSubsystem* DolbyIOSubsystem = GameInstance->GetSubsystem<UDolbyIOSubsystem>())
+			if (UGameInstance* GameInstance = World->GetGameInstance())
 			{
-#define DLB_BIND(Event) DolbyIOSubsystem->Event.AddDynamic(this, &UDolbyIOObserver::Fwd##Event);
-				DLB_BIND(OnTokenNeeded);
+				return GameInstance->GetSubsystem<UDolbyIOSubsystem>();
+			}
+		}
+		return nullptr;
+	}
+}
 
-				DLB_BIND(OnInitialized);
-				DLB_BIND(OnSetTokenError);
+void UDolbyIOObserver::InitializeComponent()
+{
+	if (GetDolbyIOSubsystem(*this))
+	{
+		UpdateEventBindings();
+		FwdOnTokenNeeded();
+	}
+}
 
-				DLB_BIND(OnConnected);
-				DLB_BIND(OnConnectError);
-				DLB_BIND(OnDemoConferenceError);
+void UDolbyIOObserver::UninitializeComponent()
+{
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(*this))
+	{
+		BindEvents(*DolbyIOSubsystem, false);
+	}
+}
+
+void UDolbyIOObserver::UpdateEventBindings()
+{
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(*this))
+	{
+		BindEvents(*DolbyIOSubsystem, true);
+	}
+}
 
-				DLB_BIND(OnDisconnected);
-				DLB_BIND(OnDisconnectError);
+void UDolbyIOObserver::BindEvents(UDolbyIOSubsystem& DolbyIOSubsystem, bool bKeepBoundEvents)
+{
+	// With bForwardOnlyBoundEvents, only events which have handlers on this observer are forwarded, so that the
+	// subsystem does not broadcast every event to every observer.
+#define DLB_BIND(Event)                                                               \
+	if (bKeepBoundEvents && (!bForwardOnlyBoundEvents || Event.IsBound()))            \
+	{                                                                                 \
+		DolbyIOSubsystem.Event.AddUniqueDynamic(this, &UDolbyIOObserver::Fwd##Event); \
+	}                                                                                 \
+	else                                                                              \
+	{                                                                                 \
+		DolbyIOSubsystem.Event.RemoveDynamic(this, &UDolbyIOObserver::Fwd##Event);    \
+	}
+	DLB_BIND(OnTokenNeeded);
 
-				DLB_BIND(OnSetSpatialEnvironmentScaleError);
+	DLB_BIND(OnInitialized);
+	DLB_BIND(OnSetTokenError);
 
-				DLB_BIND(OnMuteInputError);
+	DLB_BIND(OnConnected);
+	DLB_BIND(OnConnectError);
+	DLB_BIND(OnConnectionTimings);
+	DLB_BIND(OnWarmUpConnectionError);
+	DLB_BIND(OnDemoConferenceError);
 
-				DLB_BIND(OnUnmuteInputError);
+	DLB_BIND(OnDisconnected);
+	DLB_BIND(OnDisconnectError);
 
-				DLB_BIND(OnMuteOutputError);
+	DLB_BIND(OnReconnecting);
+	DLB_BIND(OnReconnected);
 
-				DLB_BIND(OnUnmuteOutputError);
+	DLB_BIND(OnSetSpatialEnvironmentScaleError);
 
-				DLB_BIND(OnMuteParticipantError);
+	DLB_BIND(OnMuteInputError);
 
-				DLB_BIND(OnUnmuteParticipantError);
+	DLB_BIND(OnUnmuteInputError);
 
-				DLB_BIND(OnParticipantAdded);
-				DLB_BIND(OnParticipantUpdated);
-				DLB_BIND(OnRemoteParticipantConnected);
-				DLB_BIND(OnRemoteParticipantDisconnected);
+	DLB_BIND(OnMuteOutputError);
 
-				DLB_BIND(OnLocalParticipantUpdated);
+	DLB_BIND(OnUnmuteOutputError);
 
-				DLB_BIND(OnVideoTrackAdded);
+	DLB_BIND(OnMuteParticipantError);
 
-				DLB_BIND(OnVideoTrackRemoved);
+	DLB_BIND(OnUnmuteParticipantError);
 
-				DLB_BIND(OnVideoTrackEnabled);
+	DLB_BIND(OnParticipantAdded);
+	DLB_BIND(OnParticipantUpdated);
+	DLB_BIND(OnRemoteParticipantConnected);
+	DLB_BIND(OnRemoteParticipantDisconnected);
 
-				DLB_BIND(OnVideoTrackDisabled);
+	DLB_BIND(OnLocalParticipantUpdated);
 
-				DLB_BIND(OnVideoEnabled);
-				DLB_BIND(OnEnableVideoError);
+	DLB_BIND(OnVideoTrackAdded);
 
-				DLB_BIND(OnVideoDisabled);
-				DLB_BIND(OnDisableVideoError);
+	DLB_BIND(OnVideoTrackRemoved);
 
-				DLB_BIND(OnScreenshareSourcesReceived);
-				DLB_BIND(OnGetScreenshareSourcesError);
+	DLB_BIND(OnVideoTrackEnabled);
 
-				DLB_BIND(OnScreenshareStarted);
-				DLB_BIND(OnStartScreenshareError);
+	DLB_BIND(OnVideoTrackDisabled);
 
-				DLB_BIND(OnScreenshareStopped);
-				DLB_BIND(OnStopScreenshareError);
+	DLB_BIND(OnVideoEnabled);
+	DLB_BIND(OnEnableVideoError);
 
-				DLB_BIND(OnChangeScreenshareParametersError);
+	DLB_BIND(OnVideoDisabled);
+	DLB_BIND(OnDisableVideoError);
 
-				DLB_BIND(OnCurrentScreenshareSourceReceived);
-				DLB_BIND(OnGetCurrentScreenshareSourceError);
+	DLB_BIND(OnScreenshareSourcesReceived);
+	DLB_BIND(OnGetScreenshareSourcesError);
 
-				DLB_BIND(OnActiveSpeakersChanged);
+	DLB_BIND(OnScreenshareStarted);
+	DLB_BIND(OnStartScreenshareError);
 
-				DLB_BIND(OnAudioLevelsChanged);
+	DLB_BIND(OnScreenshareStopped);
+	DLB_BIND(OnStopScreenshareError);
 
-				DLB_BIND(OnSetLocalPlayerLocationError);
+	DLB_BIND(OnChangeScreenshareParametersError);
 
-				DLB_BIND(OnSetLocalPlayerRotationError);
+	DLB_BIND(OnCurrentScreenshareSourceReceived);
+	DLB_BIND(OnGetCurrentScreenshareSourceError);
 
-				DLB_BIND(OnSetRemotePlayerLocationError);
+	DLB_BIND(OnActiveSpeakersChanged);
+	DLB_BIND(OnSpeakerStarted);
+	DLB_BIND(OnSpeakerStopped);
 
-				DLB_BIND(OnSetLogSettingsError);
+	DLB_BIND(OnAudioLevelsChanged);
 
-				DLB_BIND(OnAudioInputDevicesReceived);
-				DLB_BIND(OnGetAudioInputDevicesError);
+	DLB_BIND(OnSetLocalPlayerLocationError);
 
-				DLB_BIND(OnAudioOutputDevicesReceived);
-				DLB_BIND(OnGetAudioOutputDevicesError);
+	DLB_BIND(OnSetLocalPlayerRotationError);
 
-				DLB_BIND(OnCurrentAudioInputDeviceReceived);
-				DLB_BIND(OnGetCurrentAudioInputDeviceError);
+	DLB_BIND(OnSetRemotePlayerLocationError);
 
-				DLB_BIND(OnCurrentAudioOutputDeviceReceived);
-				DLB_BIND(OnGetCurrentAudioOutputDeviceError);
+	DLB_BIND(OnSetLogSettingsError);
 
-				DLB_BIND(OnVideoDevicesReceived);
-				DLB_BIND(OnGetVideoDevicesError);
+	DLB_BIND(OnAudioInputDevicesReceived);
+	DLB_BIND(OnGetAudioInputDevicesError);
 
-				DLB_BIND(OnCurrentVideoDeviceReceived);
-				DLB_BIND(OnGetCurrentVideoDeviceError);
+	DLB_BIND(OnAudioOutputDevicesReceived);
+	DLB_BIND(OnGetAudioOutputDevicesError);
 
-				DLB_BIND(OnCurrentAudioInputDeviceChanged);
-				DLB_BIND(OnSetAudioInputDeviceError);
+	DLB_BIND(OnCurrentAudioInputDeviceReceived);
+	DLB_BIND(OnGetCurrentAudioInputDeviceError);
 
-				DLB_BIND(OnCurrentAudioOutputDeviceChanged);
-				DLB_BIND(OnSetAudioOutputDeviceError);
+	DLB_BIND(OnCurrentAudioOutputDeviceReceived);
+	DLB_BIND(OnGetCurrentAudioOutputDeviceError);
 
-				DLB_BIND(OnUpdateUserMetadataError);
+	DLB_BIND(OnVideoDevicesReceived);
+	DLB_BIND(OnGetVideoDevicesError);
 
-				DLB_BIND(OnSetAudioCaptureModeError);
+	DLB_BIND(OnCurrentVideoDeviceReceived);
+	DLB_BIND(OnGetCurrentVideoDeviceError);
 
-				DLB_BIND(OnSendMessageError);
+	DLB_BIND(OnCurrentAudioInputDeviceChanged);
+	DLB_BIND(OnSetAudioInputDeviceError);
 
-				DLB_BIND(OnMessageReceived);
+	DLB_BIND(OnCurrentAudioOutputDeviceChanged);
+	DLB_BIND(OnSetAudioOutputDeviceError);
 
-				FwdOnTokenNeeded();
-			}
-		}
-	}
+	DLB_BIND(OnUpdateUserMetadataError);
+
+	DLB_BIND(OnSetAudioCaptureModeError);
+
+	DLB_BIND(OnSendMessageError);
+
+	DLB_BIND(OnMessageReceived);
+#undef DLB_BIND
 }
@@ -2,75 +2,277 @@
 
 #include "DolbyIO.h"
 
+#include "Spatial/DolbyIOLocationInterpolator.h"
+#include "Spatial/DolbyIOSpatialCommandQueue.h"
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOIDTable.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
 
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
-#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
 
 using namespace DolbyIO;
 
+namespace
+{
+	TAutoConsoleVariable<float> CVarLocationThreshold{
+	    TEXT("DolbyIO.Spatial.LocationThreshold"), 1.0f,
+	    TEXT("Distance the first player, or a remote player whose location is batched, has to move before its "
+	         "location is sent again.")};
+
+	TAutoConsoleVariable<float> CVarRotationThreshold{
+	    TEXT("DolbyIO.Spatial.RotationThreshold"), 0.5f,
+	    TEXT("Angle in degrees the first player has to turn before its rotation is sent again.")};
+
+	TAutoConsoleVariable<bool> CVarBatchRemoteLocations{
+	    TEXT("DolbyIO.Spatial.BatchRemoteLocations"), false,
+	    TEXT("Collect the remote player locations set during a frame and send the ones which changed in a single "
+	         "batch at the end of the frame.")};
+
+	TAutoConsoleVariable<float> CVarKeepAliveSeconds{
+	    TEXT("DolbyIO.Spatial.KeepAliveSeconds"), 1.0f,
+	    TEXT("Interval at which the first player's location and rotation are sent even if they do not change.")};
+}
+
 void UDolbyIOSubsystem::SetLocalPlayerLocation(const FVector& Location)
 {
-	if (LocationTimerHandle.IsValid())
+	if (bIsLocationSetAutomatically)
 	{
 		DLB_UE_LOG("Disabling automatic location setting");
-		GetGameInstance()->GetTimerManager().ClearTimer(LocationTimerHandle);
+		bIsLocationSetAutomatically = false;
 	}
 	SetLocalPlayerLocationImpl(Location);
 }
 
 void UDolbyIOSubsystem::SetLocalPlayerLocationImpl(const FVector& Location)
 {
-	if (!IsConnectedAsActive() || !IsSpatialAudio())
+	if (!Sdk || !IsConnectedAsActive() || !IsSpatialAudio())
 	{
 		return;
 	}
 
+	SpatialCommandQueue->Push(FSpatialCommandQueue::ECommand::LocalPosition, Location,
+	                          FIDTable::Intern(LocalParticipantID));
+	LastSentLocation = Location;
+	LastLocationSendTime = FPlatformTime::Seconds();
+	CountSpatialUpdates(1);
+}
+
+// Called on the spatial command thread. Sdk is assigned on the game thread before the first command is pushed and is
+// only released after the thread is stopped, so the push publishes it to this thread.
+void UDolbyIOSubsystem::ForwardLocalPlayerLocation(const FVector& Location, FIDHandle ParticipantID)
+{
 	Sdk->conference()
-	    .set_spatial_position(ToStdString(LocalParticipantID), {Location.X, Location.Y, Location.Z})
+	    .set_spatial_position(FIDTable::ToStdString(ParticipantID), {Location.X, Location.Y, Location.Z})
 	    .on_error(DLB_ERROR_HANDLER(OnSetLocalPlayerLocationError));
 }
 
 void UDolbyIOSubsystem::SetLocalPlayerRotation(const FRotator& Rotation)
 {
-	if (RotationTimerHandle.IsValid())
+	if (bIsRotationSetAutomatically)
 	{
 		DLB_UE_LOG("Disabling automatic rotation setting");
-		GetGameInstance()->GetTimerManager().ClearTimer(RotationTimerHandle);
+		bIsRotationSetAutomatically = false;
 	}
 	SetLocalPlayerRotationImpl(Rotation);
 }
 
 void UDolbyIOSubsystem::SetLocalPlayerRotationImpl(const FRotator& Rotation)
 {
-	if (!IsConnectedAsActive() || !IsSpatialAudio())
+	if (!Sdk || !IsConnectedAsActive() || !IsSpatialAudio())
 	{
 		return;
 	}
 
 	// The SDK expects the direction values to mean rotations around the {x,y,z} axes as specified by the
 	// environment. In Unreal, rotation around x is roll (because x is forward), y is pitch and z is yaw.
+	SpatialCommandQueue->Push(FSpatialCommandQueue::ECommand::LocalDirection,
+	                          {Rotation.Roll, Rotation.Pitch, Rotation.Yaw}, InvalidIDHandle);
+	LastSentRotation = Rotation;
+	LastRotationSendTime = FPlatformTime::Seconds();
+	CountSpatialUpdates(1);
+}
+
+// Called on the spatial command thread, see ForwardLocalPlayerLocation.
+void UDolbyIOSubsystem::ForwardLocalPlayerDirection(const FVector& Direction)
+{
 	Sdk->conference()
-	    .set_spatial_direction({Rotation.Roll, Rotation.Pitch, Rotation.Yaw})
+	    .set_spatial_direction({Direction.X, Direction.Y, Direction.Z})
 	    .on_error(DLB_ERROR_HANDLER(OnSetLocalPlayerRotationError));
 }
 
 void UDolbyIOSubsystem::SetRemotePlayerLocation(const FString& ParticipantID, const FVector& Location)
 {
-	if (!IsConnectedAsActive() || SpatialAudioStyle != EDolbyIOSpatialAudioStyle::Individual ||
-	    ParticipantID == LocalParticipantID)
+	if (!CanSetRemotePlayerLocations() || ParticipantID == LocalParticipantID)
+	{
+		return;
+	}
+
+	// IDs are only looked up, not interned, so that arbitrary strings passed from Blueprints do not grow the ID table.
+	// Participants who have not joined yet are skipped.
+	const FIDHandle ID = FIDTable::Find(ParticipantID);
+	if (ID == InvalidIDHandle)
+	{
+		return;
+	}
+	if (CVarBatchRemoteLocations.GetValueOnGameThread())
 	{
+		PendingRemoteLocations.Add(ID, Location);
 		return;
 	}
 
 	Sdk->conference()
-	    .set_spatial_position(ToStdString(ParticipantID), {Location.X, Location.Y, Location.Z})
+	    .set_spatial_position(FIDTable::ToStdString(ID), {Location.X, Location.Y, Location.Z})
 	    .on_error(DLB_ERROR_HANDLER(OnSetRemotePlayerLocationError));
+	LastSentRemoteLocations.Add(ID, Location);
+	CountSpatialUpdates(1);
+}
+
+void UDolbyIOSubsystem::SetRemotePlayerLocations(const TMap<FString, FVector>& Locations)
+{
+	if (!CanSetRemotePlayerLocations())
+	{
+		return;
+	}
+
+	dolbyio::comms::spatial_audio_batch_update Batch;
+	int Count = 0;
+	for (const auto& Location : Locations)
+	{
+		const FIDHandle ID = FIDTable::Find(Location.Key);
+		if (ID != InvalidIDHandle && Location.Key != LocalParticipantID)
+		{
+			Batch.set_spatial_position(FIDTable::ToStdString(ID),
+			                           {Location.Value.X, Location.Value.Y, Location.Value.Z});
+			LastSentRemoteLocations.Add(ID, Location.Value);
+			PendingRemoteLocations.Remove(ID);
+			++Count;
+		}
+	}
+
+	if (Count)
+	{
+		Sdk->conference()
+		    .update_spatial_audio_configuration(MoveTemp(Batch))
+		    .on_error(DLB_ERROR_HANDLER(OnSetRemotePlayerLocationError));
+		CountSpatialUpdates(Count);
+	}
+}
+
+void UDolbyIOSubsystem::AddRemotePlayerLocationSample(const FString& ParticipantID, const FVector& Location,
+                                                      const FVector& Velocity)
+{
+	if (!CanSetRemotePlayerLocations() || ParticipantID == LocalParticipantID)
+	{
+		return;
+	}
+
+	const FIDHandle ID = FIDTable::Find(ParticipantID);
+	if (ID != InvalidIDHandle)
+	{
+		LocationInterpolator->AddSample(ID, Location, Velocity, FPlatformTime::Seconds());
+	}
+}
+
+void UDolbyIOSubsystem::InterpolateRemotePlayerLocations()
+{
+	if (!CanSetRemotePlayerLocations())
+	{
+		LocationInterpolator->Reset();
+		return;
+	}
+
+	LocationInterpolator->Evaluate(FPlatformTime::Seconds(), PendingRemoteLocations);
+}
+
+bool UDolbyIOSubsystem::CanSetRemotePlayerLocations() const
+{
+	return Sdk && IsConnectedAsActive() && SpatialAudioStyle == EDolbyIOSpatialAudioStyle::Individual;
+}
+
+void UDolbyIOSubsystem::FlushRemotePlayerLocations()
+{
+	if (!CanSetRemotePlayerLocations())
+	{
+		PendingRemoteLocations.Reset();
+		LastSentRemoteLocations.Reset();
+		return;
+	}
+	if (!PendingRemoteLocations.Num())
+	{
+		return;
+	}
+
+	const float Threshold = CVarLocationThreshold.GetValueOnGameThread();
+	dolbyio::comms::spatial_audio_batch_update Batch;
+	int Count = 0;
+	for (const auto& Location : PendingRemoteLocations)
+	{
+		const FVector* LastSent = LastSentRemoteLocations.Find(Location.Key);
+		if (!LastSent || FVector::DistSquared(Location.Value, *LastSent) > Threshold * Threshold)
+		{
+			Batch.set_spatial_position(FIDTable::ToStdString(Location.Key),
+			                           {Location.Value.X, Location.Value.Y, Location.Value.Z});
+			LastSentRemoteLocations.Add(Location.Key, Location.Value);
+			++Count;
+		}
+	}
+	PendingRemoteLocations.Reset();
+
+	if (Count)
+	{
+		Sdk->conference()
+		    .update_spatial_audio_configuration(MoveTemp(Batch))
+		    .on_error(DLB_ERROR_HANDLER(OnSetRemotePlayerLocationError));
+		CountSpatialUpdates(Count);
+	}
+}
+
+void UDolbyIOSubsystem::CountSpatialUpdates(int Count)
+{
+#if STATS
+	SpatialUpdateCount += Count;
+	const double Now = FPlatformTime::Seconds();
+	const double Elapsed = Now - SpatialUpdateCountStartTime;
+	if (Elapsed >= 1.0)
+	{
+		SET_DWORD_STAT(STAT_DolbyIO_SpatialUpdatesPerSecond, FMath::RoundToInt(SpatialUpdateCount / Elapsed));
+		SpatialUpdateCount = 0;
+		SpatialUpdateCountStartTime = Now;
+	}
+#endif
+}
+
+void UDolbyIOSubsystem::Tick(float DeltaTime)
+{
+	CountSpatialUpdates(0); // keeps the rate up to date when nothing is being sent
+	UpdateSpatialUsingFirstPlayer();
+	GatherSpatialSources();
+	InterpolateRemotePlayerLocations();
+	FlushRemotePlayerLocations();
+	UpdateAudioCulling();
+	UpdateReconnect();
+	ReportConnectionTimings();
+}
+
+bool UDolbyIOSubsystem::IsTickable() const
+{
+	return !IsTemplate() && !bIsDeinitialized;
+}
+
+bool UDolbyIOSubsystem::IsTickableWhenPaused() const
+{
+	return true;
+}
+
+TStatId UDolbyIOSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDolbyIOSubsystem, STATGROUP_Tickables);
 }
 
 namespace
@@ -88,18 +290,160 @@ namespace
 	}
 }
 
-void UDolbyIOSubsystem::SetLocationUsingFirstPlayer()
+void UDolbyIOSubsystem::UpdateSpatialUsingFirstPlayer()
+{
+	// Only send the transform when it changes noticeably or when the keep-alive interval elapses, and always right
+	// after connecting.
+	const bool bIsConnectedAsActive = IsConnectedAsActive();
+	const bool bJustConnected = bIsConnectedAsActive && !bWasConnectedAsActive;
+	bWasConnectedAsActive = bIsConnectedAsActive;
+	if (!bIsConnectedAsActive || (!bIsLocationSetAutomatically && !bIsRotationSetAutomatically))
+	{
+		return;
+	}
+
+	APawn* Pawn = GetFirstPlayerPawn(GetGameInstance());
+	if (!Pawn)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const double KeepAlive = CVarKeepAliveSeconds.GetValueOnGameThread();
+	if (bIsLocationSetAutomatically)
+	{
+		const FVector Location = Pawn->GetActorLocation();
+		const float Threshold = CVarLocationThreshold.GetValueOnGameThread();
+		if (bJustConnected || Now - LastLocationSendTime >= KeepAlive ||
+		    FVector::DistSquared(Location, LastSentLocation) > Threshold * Threshold)
+		{
+			SetLocalPlayerLocationImpl(Location);
+		}
+	}
+	if (bIsRotationSetAutomatically)
+	{
+		const FRotator Rotation = Pawn->GetActorRotation();
+		if (bJustConnected || Now - LastRotationSendTime >= KeepAlive ||
+		    !Rotation.Equals(LastSentRotation, CVarRotationThreshold.GetValueOnGameThread()))
+		{
+			SetLocalPlayerRotationImpl(Rotation);
+		}
+	}
+}
+
+void UDolbyIOSubsystem::RegisterSpatialSource(UDolbyIOSpatialSourceComponent& Source)
+{
+	SpatialSources.Add(&Source);
+	SpatialSourceIDs.Add(Source.ParticipantID.IsEmpty() ? InvalidIDHandle : FIDTable::Intern(Source.ParticipantID));
+	SpatialSourceLocations.Add(FVector::ZeroVector);
+	SpatialSourceSentLocations.Add(FVector::ZeroVector);
+	bSpatialSourcesNeedFullUpdate = true;
+}
+
+void UDolbyIOSubsystem::UnregisterSpatialSource(UDolbyIOSpatialSourceComponent& Source)
+{
+	const int32 Index = SpatialSources.Find(&Source);
+	if (Index != INDEX_NONE)
+	{
+		SpatialSources.RemoveAtSwap(Index);
+		SpatialSourceIDs.RemoveAtSwap(Index);
+		SpatialSourceLocations.RemoveAtSwap(Index);
+		SpatialSourceSentLocations.RemoveAtSwap(Index);
+	}
+}
+
+void UDolbyIOSubsystem::UpdateSpatialSourceParticipant(UDolbyIOSpatialSourceComponent& Source)
+{
+	const int32 Index = SpatialSources.Find(&Source);
+	if (Index != INDEX_NONE)
+	{
+		SpatialSourceIDs[Index] =
+		    Source.ParticipantID.IsEmpty() ? InvalidIDHandle : FIDTable::Intern(Source.ParticipantID);
+		bSpatialSourcesNeedFullUpdate = true;
+	}
+}
+
+void UDolbyIOSubsystem::GatherSpatialSources()
+{
+	if (!SpatialSources.Num())
+	{
+		return;
+	}
+	if (!CanSetRemotePlayerLocations())
+	{
+		bSpatialSourcesNeedFullUpdate = true;
+		return;
+	}
+
+	// Gather all transforms first, then compare them in a tight loop over the parallel arrays and queue only the
+	// changed ones, which FlushRemotePlayerLocations then sends in a single batch.
+	const int32 Num = SpatialSources.Num();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		if (const AActor* Owner = SpatialSources[i]->GetOwner())
+		{
+			SpatialSourceLocations[i] = Owner->GetActorLocation();
+		}
+	}
+
+	const FIDHandle LocalID = FIDTable::Find(LocalParticipantID);
+	const float Threshold = CVarLocationThreshold.GetValueOnGameThread();
+	const float ThresholdSquared = Threshold * Threshold;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const FIDHandle ID = SpatialSourceIDs[i];
+		if (ID != InvalidIDHandle && ID != LocalID &&
+		    (bSpatialSourcesNeedFullUpdate ||
+		     FVector::DistSquared(SpatialSourceLocations[i], SpatialSourceSentLocations[i]) > ThresholdSquared))
+		{
+			PendingRemoteLocations.Add(ID, SpatialSourceLocations[i]);
+			SpatialSourceSentLocations[i] = SpatialSourceLocations[i];
+		}
+	}
+	bSpatialSourcesNeedFullUpdate = false;
+}
+
+namespace
+{
+	UDolbyIOSubsystem* GetDolbyIOSubsystem(const UActorComponent& Component)
+	{
+		if (UWorld* World = Component.GetWorld())
+		{
+			if (UGameInstance* GameInstance = World->GetGameInstance())
+			{
+				return GameInstance->GetSubsystem<UDolbyIOSubsystem>();
+			}
+		}
+		return nullptr;
+	}
+}
+
+void UDolbyIOSpatialSourceComponent::SetParticipantID(const FString& NewParticipantID)
+{
+	ParticipantID = NewParticipantID;
+	if (HasBegunPlay())
+	{
+		if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(*this))
+		{
+			DolbyIOSubsystem->UpdateSpatialSourceParticipant(*this);
+		}
+	}
+}
+
+void UDolbyIOSpatialSourceComponent::BeginPlay()
 {
-	if (APawn* Pawn = GetFirstPlayerPawn(GetGameInstance()))
+	Super::BeginPlay();
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(*this))
 	{
-		SetLocalPlayerLocationImpl(Pawn->GetActorLocation());
+		DolbyIOSubsystem->RegisterSpatialSource(*this);
 	}
 }
 
-void UDolbyIOSubsystem::SetRotationUsingFirstPlayer()
+void UDolbyIOSpatialSourceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (APawn* Pawn = GetFirstPlayerPawn(GetGameInstance()))
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(*this))
 	{
-		SetLocalPlayerRotationImpl(Pawn->GetActorRotation());
+		DolbyIOSubsystem->UnregisterSpatialSource(*this);
 	}
+	Super::EndPlay(EndPlayReason);
 }
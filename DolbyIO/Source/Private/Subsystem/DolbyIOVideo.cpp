@@ -42,7 +42,7 @@ void UDolbyIOSubsystem::EnableVideo(const FDolbyIOVideoDevice& VideoDevice, bool
 	        [this, VideoDevice]
 	        {
 		        bIsVideoEnabled = true;
-		        BroadcastEvent(OnVideoEnabled, LocalCameraTrackID);
+		        BroadcastEventWithNative(*this, OnVideoEnabled, OnVideoEnabledNative, LocalCameraTrackID);
 	        })
 	    .on_error(DLB_ERROR_HANDLER(OnEnableVideoError));
 }
@@ -62,7 +62,7 @@ void UDolbyIOSubsystem::DisableVideo()
 	        [this]
 	        {
 		        bIsVideoEnabled = false;
-		        BroadcastEvent(OnVideoDisabled, LocalCameraTrackID);
+		        BroadcastEventWithNative(*this, OnVideoDisabled, OnVideoDisabledNative, LocalCameraTrackID);
 	        })
 	    .on_error(DLB_ERROR_HANDLER(OnDisableVideoError));
 }
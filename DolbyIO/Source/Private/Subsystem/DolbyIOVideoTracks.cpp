@@ -2,10 +2,15 @@
 
 #include "DolbyIO.h"
 
+#include "Backend/DolbyIOFakeBackend.h"
 #include "Utils/DolbyIOBroadcastEvent.h"
+#include "Utils/DolbyIOConnectionTimer.h"
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOIDTable.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
 #include "Video/DolbyIOVideoSink.h"
 
 using namespace dolbyio::comms;
@@ -13,16 +18,17 @@ using namespace DolbyIO;
 
 void UDolbyIOSubsystem::BindMaterial(UMaterialInstanceDynamic* Material, const FString& VideoTrackID)
 {
+	const FIDHandle TrackID = FIDTable::Find(VideoTrackID);
 	FScopeLock Lock{&VideoSinksLock};
 	for (auto& Sink : VideoSinks)
 	{
-		if (Sink.Key != VideoTrackID)
+		if (Sink.Key != TrackID)
 		{
 			Sink.Value->UnbindMaterial(Material);
 		}
 	}
 
-	if (const std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	if (const std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(TrackID))
 	{
 		(*Sink)->BindMaterial(Material);
 	}
@@ -30,8 +36,9 @@ void UDolbyIOSubsystem::BindMaterial(UMaterialInstanceDynamic* Material, const F
 
 void UDolbyIOSubsystem::UnbindMaterial(UMaterialInstanceDynamic* Material, const FString& VideoTrackID)
 {
+	const FIDHandle TrackID = FIDTable::Find(VideoTrackID);
 	FScopeLock Lock{&VideoSinksLock};
-	if (const std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	if (const std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(TrackID))
 	{
 		(*Sink)->UnbindMaterial(Material);
 	}
@@ -39,8 +46,9 @@ void UDolbyIOSubsystem::UnbindMaterial(UMaterialInstanceDynamic* Material, const
 
 UTexture2D* UDolbyIOSubsystem::GetTexture(const FString& VideoTrackID)
 {
+	const FIDHandle TrackID = FIDTable::Find(VideoTrackID);
 	FScopeLock Lock{&VideoSinksLock};
-	if (const std::shared_ptr<FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	if (const std::shared_ptr<FVideoSink>* Sink = VideoSinks.Find(TrackID))
 	{
 		return (*Sink)->GetTexture();
 	}
@@ -50,8 +58,9 @@ UTexture2D* UDolbyIOSubsystem::GetTexture(const FString& VideoTrackID)
 void UDolbyIOSubsystem::BroadcastVideoTrackAdded(const FDolbyIOVideoTrack& VideoTrack)
 {
 	DLB_UE_LOG("Video track added: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
+	ConnectionTimer->Record(FConnectionTimer::EStage::FirstRemoteVideoFrame); // the texture exists once a frame arrived
 	WarnIfVideoTrackSuspicious(VideoTrack.TrackID);
-	BroadcastEvent(OnVideoTrackAdded, VideoTrack);
+	BroadcastEventWithNative(*this, OnVideoTrackAdded, OnVideoTrackAddedNative, VideoTrack);
 }
 
 void UDolbyIOSubsystem::WarnIfVideoTrackSuspicious(const FString& VideoTrackID)
@@ -65,17 +74,17 @@ void UDolbyIOSubsystem::WarnIfVideoTrackSuspicious(const FString& VideoTrackID)
 void UDolbyIOSubsystem::BroadcastVideoTrackEnabled(const FDolbyIOVideoTrack& VideoTrack)
 {
 	DLB_UE_LOG("Video track enabled: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
-	BroadcastEvent(OnVideoTrackEnabled, VideoTrack);
+	BroadcastEventWithNative(*this, OnVideoTrackEnabled, OnVideoTrackEnabledNative, VideoTrack);
 }
 
-void UDolbyIOSubsystem::ProcessBufferedVideoTracks(const FString& ParticipantID)
+void UDolbyIOSubsystem::ProcessBufferedVideoTracks(FIDHandle ParticipantID)
 {
 	if (TArray<FDolbyIOVideoTrack>* AddedTracks = BufferedAddedVideoTracks.Find(ParticipantID))
 	{
 		FScopeLock Lock{&VideoSinksLock};
 		for (const FDolbyIOVideoTrack& AddedTrack : *AddedTracks)
 		{
-			if (std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(AddedTrack.TrackID))
+			if (std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(FIDTable::Intern(AddedTrack.TrackID)))
 			{
 				(*Sink)->OnTextureCreated(
 				    [=]
@@ -108,69 +117,138 @@ void UDolbyIOSubsystem::ProcessBufferedVideoTracks(const FString& ParticipantID)
 
 void UDolbyIOSubsystem::Handle(const remote_video_track_added& Event)
 {
+	DLB_TRACE_CPU_SCOPE(Handle_remote_video_track_added);
+
+	const FIDHandle TrackID = FIDTable::Intern(Event.track.sdp_track_id);
+	const FIDHandle ParticipantID = FIDTable::Intern(Event.track.peer_id);
 	const FDolbyIOVideoTrack VideoTrack = ToFDolbyIOVideoTrack(Event.track);
 
 	FScopeLock Lock1{&VideoSinksLock};
-	VideoSinks.Emplace(VideoTrack.TrackID, std::make_shared<FVideoSink>(VideoTrack.TrackID));
-	Sdk->video()
-	    .remote()
-	    .set_video_sink(Event.track, VideoSinks[VideoTrack.TrackID])
-	    .on_error(DLB_ERROR_HANDLER_NO_DELEGATE);
+	// Tracks coming back after a reconnect keep their sink, so bound materials keep showing the last frame
+	const bool bWasParked = ParkedVideoTracks.Remove(TrackID) > 0;
+	const std::shared_ptr<FVideoSink>& Sink =
+	    bWasParked ? VideoSinks.FindChecked(TrackID)
+	               : VideoSinks.Emplace(TrackID, std::make_shared<FVideoSink>(VideoTrack.TrackID));
+	TRACE_COUNTER_SET(DolbyIO_VideoTracks, VideoSinks.Num());
+	SET_DWORD_STAT(STAT_DolbyIO_ActiveSinks, VideoSinks.Num());
+#if DOLBYIO_WITH_FAKE_BACKEND
+	if (FakeBackend)
+	{
+		FakeBackend->SetVideoSink(VideoTrack.TrackID, Sink);
+	}
+	else
+#endif
+	{
+		Sdk->video().remote().set_video_sink(Event.track, Sink).on_error(DLB_ERROR_HANDLER_NO_DELEGATE);
+	}
+	if (bWasParked)
+	{
+		DLB_UE_LOG("Video track resumed: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID,
+		           *VideoTrack.ParticipantID);
+		return;
+	}
 
 	FScopeLock Lock2{&RemoteParticipantsLock};
-	if (RemoteParticipants.Contains(VideoTrack.ParticipantID))
+	if (RemoteParticipants.Contains(ParticipantID))
 	{
-		VideoSinks[VideoTrack.TrackID]->OnTextureCreated([this, VideoTrack] { BroadcastVideoTrackAdded(VideoTrack); });
+		Sink->OnTextureCreated([this, VideoTrack] { BroadcastVideoTrackAdded(VideoTrack); });
 	}
 	else
 	{
 		DLB_UE_LOG("Buffering video track added: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID,
 		           *VideoTrack.ParticipantID);
-		BufferedAddedVideoTracks.FindOrAdd(VideoTrack.ParticipantID).Add(VideoTrack);
+		BufferedAddedVideoTracks.FindOrAdd(ParticipantID).Add(VideoTrack);
 	}
 }
 
 void UDolbyIOSubsystem::Handle(const remote_video_track_removed& Event)
 {
+	DLB_TRACE_CPU_SCOPE(Handle_remote_video_track_removed);
+
+	const FIDHandle TrackID = FIDTable::Intern(Event.track.sdp_track_id);
 	const FDolbyIOVideoTrack VideoTrack = ToFDolbyIOVideoTrack(Event.track);
 	DLB_UE_LOG("Video track removed: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
 	WarnIfVideoTrackSuspicious(VideoTrack.TrackID);
 
 	FScopeLock Lock{&VideoSinksLock};
-	if (std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(VideoTrack.TrackID))
+	if (bIsReconnecting && VideoSinks.Contains(TrackID))
+	{
+		DLB_UE_LOG("Parking video track until reconnected");
+		ParkedVideoTracks.Emplace(TrackID, VideoTrack);
+		return;
+	}
+	if (std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(TrackID))
 	{
 		(*Sink)->UnbindAllMaterials();
-		VideoSinks.Remove(VideoTrack.TrackID);
+		VideoSinks.Remove(TrackID);
+		TRACE_COUNTER_SET(DolbyIO_VideoTracks, VideoSinks.Num());
+		SET_DWORD_STAT(STAT_DolbyIO_ActiveSinks, VideoSinks.Num());
 	}
 	else
 	{
 		DLB_UE_LOG_BASE(Warning, "Non-existent video track removed");
 	}
 
-	BroadcastEvent(OnVideoTrackRemoved, VideoTrack);
+	BroadcastEventWithNative(*this, OnVideoTrackRemoved, OnVideoTrackRemovedNative, VideoTrack);
 }
 
-void UDolbyIOSubsystem::Handle(const utils::vfs_event& Event)
+void UDolbyIOSubsystem::RemoveParkedVideoTracks()
 {
-	for (const auto& TrackMapItem : Event.new_enabled)
+	TArray<FDolbyIOVideoTrack> RemovedTracks;
 	{
-		const FDolbyIOVideoTrack VideoTrack = ToFDolbyIOVideoTrack(TrackMapItem);
-
-		if (GetTexture(VideoTrack.TrackID))
-		{
-			BroadcastVideoTrackEnabled(VideoTrack);
-		}
-		else
+		FScopeLock Lock{&VideoSinksLock};
+		for (const auto& ParkedTrack : ParkedVideoTracks)
 		{
-			DLB_UE_LOG("Buffering video track enabled: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID,
-			           *VideoTrack.ParticipantID);
-			BufferedEnabledVideoTracks.FindOrAdd(VideoTrack.ParticipantID).Add(VideoTrack);
+			if (std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(ParkedTrack.Key))
+			{
+				(*Sink)->UnbindAllMaterials();
+				VideoSinks.Remove(ParkedTrack.Key);
+			}
+			RemovedTracks.Add(ParkedTrack.Value);
 		}
+		ParkedVideoTracks.Empty();
+		TRACE_COUNTER_SET(DolbyIO_VideoTracks, VideoSinks.Num());
+		SET_DWORD_STAT(STAT_DolbyIO_ActiveSinks, VideoSinks.Num());
+	}
+
+	for (const FDolbyIOVideoTrack& VideoTrack : RemovedTracks)
+	{
+		DLB_UE_LOG("Parked video track removed: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID,
+		           *VideoTrack.ParticipantID);
+		BroadcastEventWithNative(*this, OnVideoTrackRemoved, OnVideoTrackRemovedNative, VideoTrack);
+	}
+}
+
+void UDolbyIOSubsystem::Handle(const utils::vfs_event& Event)
+{
+	DLB_TRACE_CPU_SCOPE(Handle_vfs_event);
+
+	for (const auto& TrackMapItem : Event.new_enabled)
+	{
+		HandleVideoTrackEnabled(ToFDolbyIOVideoTrack(TrackMapItem));
 	}
 	for (const auto& TrackMapItem : Event.new_disabled)
 	{
-		const FDolbyIOVideoTrack VideoTrack = ToFDolbyIOVideoTrack(TrackMapItem);
-		DLB_UE_LOG("Video track ID %s for participant ID %s disabled", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
-		BroadcastEvent(OnVideoTrackDisabled, VideoTrack);
+		HandleVideoTrackDisabled(ToFDolbyIOVideoTrack(TrackMapItem));
+	}
+}
+
+void UDolbyIOSubsystem::HandleVideoTrackEnabled(const FDolbyIOVideoTrack& VideoTrack)
+{
+	if (GetTexture(VideoTrack.TrackID))
+	{
+		BroadcastVideoTrackEnabled(VideoTrack);
 	}
+	else
+	{
+		DLB_UE_LOG("Buffering video track enabled: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID,
+		           *VideoTrack.ParticipantID);
+		BufferedEnabledVideoTracks.FindOrAdd(FIDTable::Intern(VideoTrack.ParticipantID)).Add(VideoTrack);
+	}
+}
+
+void UDolbyIOSubsystem::HandleVideoTrackDisabled(const FDolbyIOVideoTrack& VideoTrack)
+{
+	DLB_UE_LOG("Video track ID %s for participant ID %s disabled", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
+	BroadcastEventWithNative(*this, OnVideoTrackDisabled, OnVideoTrackDisabledNative, VideoTrack);
 }
@@ -0,0 +1,376 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && DOLBYIO_WITH_FAKE_BACKEND
+
+#include "DolbyIO.h"
+
+#include "Backend/DolbyIOFakeBackend.h"
+#include "Utils/DolbyIOEventQueue.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeExit.h"
+
+#include <atomic>
+
+namespace DolbyIO
+{
+	namespace
+	{
+		// Broadcasts queued events until the condition holds or the timeout expires.
+		bool PumpUntil(TFunctionRef<bool()> IsDone, double TimeoutSeconds = 5.0)
+		{
+			const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+			while (!IsDone())
+			{
+				if (FPlatformTime::Seconds() > Deadline)
+				{
+					return false;
+				}
+				FEventQueue::Drain();
+				FPlatformProcess::Sleep(0.001f);
+			}
+			FEventQueue::Drain();
+			return true;
+		}
+
+		// Like PumpUntil, but also ticks the subsystem, which drives reconnecting and its grace period.
+		bool PumpAndTickUntil(UDolbyIOSubsystem& Subsystem, TFunctionRef<bool()> IsDone, double TimeoutSeconds = 5.0)
+		{
+			return PumpUntil(
+			    [&]
+			    {
+				    static_cast<FTickableGameObject&>(Subsystem).Tick(0.0f);
+				    return IsDone();
+			    },
+			    TimeoutSeconds);
+		}
+
+		int CountOnAir(UDolbyIOSubsystem& Subsystem)
+		{
+			int Ret = 0;
+			for (const FDolbyIOParticipantInfo& Info : Subsystem.GetParticipants())
+			{
+				Ret += Info.Status == EDolbyIOParticipantStatus::OnAir;
+			}
+			return Ret;
+		}
+
+		// Waits without broadcasting until the fake backend has run everything scheduled so far.
+		bool WaitForWorker(FFakeBackend& FakeBackend, double TimeoutSeconds = 5.0)
+		{
+			std::atomic<bool> bIsDone{false};
+			FakeBackend.RunOnWorker([&bIsDone] { bIsDone = true; });
+			const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+			while (!bIsDone)
+			{
+				if (FPlatformTime::Seconds() > Deadline)
+				{
+					return false;
+				}
+				FPlatformProcess::Sleep(0.001f);
+			}
+			return true;
+		}
+
+		// Overrides a console variable until the end of the scope.
+		class FScopedCVar final
+		{
+		public:
+			FScopedCVar(const TCHAR* Name, const TCHAR* Value)
+			    : Variable(IConsoleManager::Get().FindConsoleVariable(Name))
+			{
+				if (Variable)
+				{
+					PreviousValue = Variable->GetString();
+					Variable->Set(Value);
+				}
+			}
+			~FScopedCVar()
+			{
+				if (Variable)
+				{
+					Variable->Set(*PreviousValue);
+				}
+			}
+
+		private:
+			IConsoleVariable* const Variable;
+			FString PreviousValue;
+		};
+
+		// A participant who does not come back within this time after reconnecting is considered gone.
+		constexpr double ReconnectGraceTimeoutSeconds = 10.0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDolbyIOFakeBackendConnectTest, "DolbyIO.FakeBackend.ConnectParticipantsDisconnect",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::EngineFilter)
+
+bool FDolbyIOFakeBackendConnectTest::RunTest(const FString& Parameters)
+{
+	using namespace DolbyIO;
+
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+	ON_SCOPE_EXIT
+	{
+		GameInstance->Shutdown();
+	};
+
+	UDolbyIOSubsystem* Subsystem = GameInstance->GetSubsystem<UDolbyIOSubsystem>();
+	if (!TestNotNull(TEXT("Subsystem"), Subsystem))
+	{
+		return false;
+	}
+
+	FFakeBackend::Install(*Subsystem);
+	FFakeBackend* FakeBackend = FFakeBackend::Get(*Subsystem);
+	if (!TestNotNull(TEXT("Fake backend"), FakeBackend))
+	{
+		return false;
+	}
+
+	int NumConnected = 0;
+	int NumDisconnected = 0;
+	int NumParticipantsAdded = 0;
+	Subsystem->OnConnectedNative.AddLambda([&](const FString&, const FString&) { ++NumConnected; });
+	Subsystem->OnDisconnectedNative.AddLambda([&] { ++NumDisconnected; });
+	Subsystem->OnParticipantAddedNative.AddLambda(
+	    [&](EDolbyIOParticipantStatus, const FDolbyIOParticipantInfo&) { ++NumParticipantsAdded; });
+
+	Subsystem->Connect("fake", "Tester");
+	TestTrue(TEXT("Connected"), PumpUntil([&] { return NumConnected == 1; }));
+	TestTrue(TEXT("Subsystem reports connected"), Subsystem->IsConnected());
+
+	const FString FirstID = FakeBackend->AddParticipant("First");
+	FakeBackend->AddParticipant("Second");
+	TestTrue(TEXT("Participants added"), PumpUntil([&] { return CountOnAir(*Subsystem) == 2; }));
+	TestEqual(TEXT("On Participant Added count"), NumParticipantsAdded, 2);
+
+	FakeBackend->RemoveParticipant(FirstID);
+	TestTrue(TEXT("Participant left"), PumpUntil([&] { return CountOnAir(*Subsystem) == 1; }));
+
+	Subsystem->Disconnect();
+	TestTrue(TEXT("Disconnected"), PumpUntil([&] { return NumDisconnected == 1; }));
+	TestFalse(TEXT("Subsystem reports disconnected"), Subsystem->IsConnected());
+
+	FFakeBackend::Uninstall(*Subsystem);
+	TestEqual(TEXT("Participants after uninstall"), Subsystem->GetParticipants().Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDolbyIOFakeBackendCoalesceTest, "DolbyIO.FakeBackend.CoalesceParticipantUpdates",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::EngineFilter)
+
+bool FDolbyIOFakeBackendCoalesceTest::RunTest(const FString& Parameters)
+{
+	using namespace DolbyIO;
+
+	const FScopedCVar Coalesce{TEXT("DolbyIO.Events.Coalesce"), TEXT("1")};
+
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+	ON_SCOPE_EXIT
+	{
+		GameInstance->Shutdown();
+	};
+
+	UDolbyIOSubsystem* Subsystem = GameInstance->GetSubsystem<UDolbyIOSubsystem>();
+	if (!TestNotNull(TEXT("Subsystem"), Subsystem))
+	{
+		return false;
+	}
+	FFakeBackend::Install(*Subsystem);
+	FFakeBackend* FakeBackend = FFakeBackend::Get(*Subsystem);
+	if (!TestNotNull(TEXT("Fake backend"), FakeBackend))
+	{
+		return false;
+	}
+
+	int NumConnected = 0;
+	int NumUpdated = 0;
+	int NumRemoteConnected = 0;
+	Subsystem->OnConnectedNative.AddLambda([&](const FString&, const FString&) { ++NumConnected; });
+	Subsystem->OnParticipantUpdatedNative.AddLambda(
+	    [&](EDolbyIOParticipantStatus, const FDolbyIOParticipantInfo&) { ++NumUpdated; });
+	Subsystem->OnRemoteParticipantConnectedNative.AddLambda([&](const FDolbyIOParticipantInfo&)
+	                                                        { ++NumRemoteConnected; });
+
+	Subsystem->Connect("fake", "Tester");
+	TestTrue(TEXT("Connected"), PumpUntil([&] { return NumConnected == 1; }));
+	const FString ParticipantID = FakeBackend->AddParticipant("Chatty");
+	TestTrue(TEXT("Participant added"), PumpUntil([&] { return CountOnAir(*Subsystem) == 1; }));
+
+	// All updates are raised before the queue is drained, possibly interleaved with uncoalesced audio level events
+	constexpr int NumUpdates = 100;
+	NumUpdated = 0;
+	NumRemoteConnected = 0;
+	const uint64 CollapsedBefore = FEventQueue::GetNumCollapsed();
+	for (int i = 0; i < NumUpdates; ++i)
+	{
+		FakeBackend->UpdateParticipant(ParticipantID);
+	}
+	TestTrue(TEXT("Updates raised"), WaitForWorker(*FakeBackend));
+	FEventQueue::Drain();
+
+	TestTrue(TEXT("Updates collapsed"), FEventQueue::GetNumCollapsed() > CollapsedBefore);
+	TestTrue(TEXT("Fewer updates broadcast than raised"), NumUpdated > 0 && NumUpdated < NumUpdates);
+	TestEqual(TEXT("On Remote Participant Connected follows each broadcast update"), NumRemoteConnected, NumUpdated);
+
+	Subsystem->Disconnect();
+	FFakeBackend::Uninstall(*Subsystem);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDolbyIOFakeBackendReconnectTest,
+                                 "DolbyIO.FakeBackend.ReconnectReconcilesParticipants",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::EngineFilter)
+
+bool FDolbyIOFakeBackendReconnectTest::RunTest(const FString& Parameters)
+{
+	using namespace DolbyIO;
+
+	const FScopedCVar NoReconnectDelay{TEXT("DolbyIO.Reconnect.InitialDelayMs"), TEXT("0")};
+
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+	ON_SCOPE_EXIT
+	{
+		GameInstance->Shutdown();
+	};
+
+	UDolbyIOSubsystem* Subsystem = GameInstance->GetSubsystem<UDolbyIOSubsystem>();
+	if (!TestNotNull(TEXT("Subsystem"), Subsystem))
+	{
+		return false;
+	}
+	FFakeBackend::Install(*Subsystem);
+	FFakeBackend* FakeBackend = FFakeBackend::Get(*Subsystem);
+	if (!TestNotNull(TEXT("Fake backend"), FakeBackend))
+	{
+		return false;
+	}
+
+	int NumConnected = 0;
+	int NumReconnected = 0;
+	int NumParticipantsAdded = 0;
+	int NumRemoteDisconnected = 0;
+	int NumVideoTracksAdded = 0;
+	int NumVideoTracksRemoved = 0;
+	Subsystem->OnConnectedNative.AddLambda([&](const FString&, const FString&) { ++NumConnected; });
+	Subsystem->OnReconnectedNative.AddLambda([&](int, float) { ++NumReconnected; });
+	Subsystem->OnParticipantAddedNative.AddLambda(
+	    [&](EDolbyIOParticipantStatus, const FDolbyIOParticipantInfo&) { ++NumParticipantsAdded; });
+	Subsystem->OnRemoteParticipantDisconnectedNative.AddLambda([&](const FDolbyIOParticipantInfo&)
+	                                                           { ++NumRemoteDisconnected; });
+	Subsystem->OnVideoTrackAddedNative.AddLambda([&](const FDolbyIOVideoTrack&) { ++NumVideoTracksAdded; });
+	Subsystem->OnVideoTrackRemovedNative.AddLambda([&](const FDolbyIOVideoTrack&) { ++NumVideoTracksRemoved; });
+
+	Subsystem->SetAutomaticReconnect(true);
+	Subsystem->Connect("fake", "Tester");
+	TestTrue(TEXT("Connected"), PumpUntil([&] { return NumConnected == 1; }));
+	const FString StayingID = FakeBackend->AddParticipant("Staying");
+	const FString LeavingID = FakeBackend->AddParticipant("Leaving");
+	FakeBackend->AddVideoTrack(StayingID, 64, 64, 10.0f);
+	TestTrue(TEXT("Participants added"), PumpUntil([&] { return CountOnAir(*Subsystem) == 2; }));
+	TestTrue(TEXT("Video track added"), PumpUntil([&] { return NumVideoTracksAdded == 1; }));
+
+	// One participant leaves while the connection is lost, so only the other one is added again after reconnecting
+	FakeBackend->ForgetParticipant(LeavingID);
+	FakeBackend->DropConnection();
+	TestTrue(TEXT("Reconnected"), PumpAndTickUntil(*Subsystem, [&] { return NumReconnected == 1; }));
+	TestEqual(TEXT("Participants kept while reconnecting"), Subsystem->GetParticipants().Num(), 2);
+
+	TestTrue(TEXT("Participant who did not come back disconnected"),
+	         PumpAndTickUntil(*Subsystem, [&] { return NumRemoteDisconnected == 1; }, ReconnectGraceTimeoutSeconds));
+	TestEqual(TEXT("On Participant Added not triggered again"), NumParticipantsAdded, 2);
+	TestEqual(TEXT("On Connected not triggered again"), NumConnected, 1);
+	TestEqual(TEXT("Participants on air after reconciling"), CountOnAir(*Subsystem), 1);
+	TestEqual(TEXT("Video track of the participant who came back kept"), NumVideoTracksRemoved, 0);
+
+	Subsystem->Disconnect();
+	FFakeBackend::Uninstall(*Subsystem);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDolbyIOFakeBackendReconnectGraceTest,
+                                 "DolbyIO.FakeBackend.ConnectDuringReconnectGrace",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::EngineFilter)
+
+bool FDolbyIOFakeBackendReconnectGraceTest::RunTest(const FString& Parameters)
+{
+	using namespace DolbyIO;
+
+	const FScopedCVar NoReconnectDelay{TEXT("DolbyIO.Reconnect.InitialDelayMs"), TEXT("0")};
+
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+	ON_SCOPE_EXIT
+	{
+		GameInstance->Shutdown();
+	};
+
+	UDolbyIOSubsystem* Subsystem = GameInstance->GetSubsystem<UDolbyIOSubsystem>();
+	if (!TestNotNull(TEXT("Subsystem"), Subsystem))
+	{
+		return false;
+	}
+	FFakeBackend::Install(*Subsystem);
+	FFakeBackend* FakeBackend = FFakeBackend::Get(*Subsystem);
+	if (!TestNotNull(TEXT("Fake backend"), FakeBackend))
+	{
+		return false;
+	}
+
+	int NumConnected = 0;
+	int NumDisconnected = 0;
+	int NumReconnected = 0;
+	int NumRemoteDisconnected = 0;
+	Subsystem->OnConnectedNative.AddLambda([&](const FString&, const FString&) { ++NumConnected; });
+	Subsystem->OnDisconnectedNative.AddLambda([&] { ++NumDisconnected; });
+	Subsystem->OnReconnectedNative.AddLambda([&](int, float) { ++NumReconnected; });
+	Subsystem->OnRemoteParticipantDisconnectedNative.AddLambda([&](const FDolbyIOParticipantInfo&)
+	                                                           { ++NumRemoteDisconnected; });
+
+	Subsystem->SetAutomaticReconnect(true);
+	Subsystem->Connect("fake", "Tester");
+	TestTrue(TEXT("Connected"), PumpUntil([&] { return NumConnected == 1; }));
+	FakeBackend->AddParticipant("Staying");
+	const FString LeavingID = FakeBackend->AddParticipant("Leaving");
+	TestTrue(TEXT("Participants added"), PumpUntil([&] { return CountOnAir(*Subsystem) == 2; }));
+
+	FakeBackend->ForgetParticipant(LeavingID);
+	FakeBackend->DropConnection();
+	TestTrue(TEXT("Reconnected"), PumpAndTickUntil(*Subsystem, [&] { return NumReconnected == 1; }));
+	const double GraceEnd = FPlatformTime::Seconds() + ReconnectGraceTimeoutSeconds;
+
+	// Leaving and joining a new conference within the grace period ends it
+	Subsystem->Disconnect();
+	TestTrue(TEXT("Disconnected"), PumpAndTickUntil(*Subsystem, [&] { return NumDisconnected == 1; }));
+	Subsystem->Connect("fake", "Tester");
+	TestTrue(TEXT("Connected again"), PumpAndTickUntil(*Subsystem, [&] { return NumConnected == 2; }));
+	FakeBackend->AddParticipant("New");
+	TestTrue(TEXT("New participant added"), PumpAndTickUntil(*Subsystem, [&] { return CountOnAir(*Subsystem) == 1; }));
+
+	PumpAndTickUntil(
+	    *Subsystem, [&] { return FPlatformTime::Seconds() > GraceEnd; }, ReconnectGraceTimeoutSeconds * 2);
+	TestEqual(TEXT("No participant of the new conference disconnected"), NumRemoteDisconnected, 0);
+	TestEqual(TEXT("Participants on air in the new conference"), CountOnAir(*Subsystem), 1);
+	TestEqual(TEXT("Participants in the new conference"), Subsystem->GetParticipants().Num(), 1);
+
+	Subsystem->Disconnect();
+	FFakeBackend::Uninstall(*Subsystem);
+	return true;
+}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Spatial/DolbyIOLocationInterpolator.h"
+
+#include "HAL/IConsoleManager.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDolbyIOLocationInterpolatorTest, "DolbyIO.Spatial.LocationInterpolator",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::EngineFilter)
+
+bool FDolbyIOLocationInterpolatorTest::RunTest(const FString& Parameters)
+{
+	using namespace DolbyIO;
+
+	IConsoleManager& ConsoleManager = IConsoleManager::Get();
+	const double Delay =
+	    ConsoleManager.FindConsoleVariable(TEXT("DolbyIO.Spatial.InterpolationDelayMs"))->GetFloat() / 1000.0;
+	const float MaxExtrapolation =
+	    ConsoleManager.FindConsoleVariable(TEXT("DolbyIO.Spatial.MaxExtrapolationMs"))->GetFloat() / 1000.0f;
+
+	// A participant moving along x at a constant speed, sampled once per second
+	constexpr FIDHandle ParticipantID = 1;
+	const FVector Velocity{100.0f, 0.0f, 0.0f};
+	FLocationInterpolator Interpolator;
+	Interpolator.AddSample(ParticipantID, FVector::ZeroVector, Velocity, 0.0);
+	Interpolator.AddSample(ParticipantID, Velocity, Velocity, 1.0);
+
+	TMap<FIDHandle, FVector> Locations;
+	Interpolator.Evaluate(0.5 + Delay, Locations);
+	if (TestTrue(TEXT("Interpolated location evaluated"), Locations.Contains(ParticipantID)))
+	{
+		TestTrue(TEXT("Interpolated between samples"), Locations[ParticipantID].Equals({50.0f, 0.0f, 0.0f}, 0.1f));
+	}
+
+	Locations.Reset();
+	Interpolator.Evaluate(2.0 + Delay, Locations);
+	if (TestTrue(TEXT("Extrapolated location evaluated"), Locations.Contains(ParticipantID)))
+	{
+		TestTrue(TEXT("Extrapolation limited"),
+		         Locations[ParticipantID].Equals(Velocity + Velocity * MaxExtrapolation, 0.1f));
+	}
+
+	Locations.Reset();
+	Interpolator.Evaluate(60.0, Locations);
+	TestEqual(TEXT("Stale participant forgotten"), Locations.Num(), 0);
+	return true;
+}
+
+#endif
@@ -2,12 +2,46 @@
 
 #pragma once
 
-#include "Async/Async.h"
+#include "Utils/DolbyIOEventQueue.h"
 
 namespace DolbyIO
 {
-	template <class TDelegate, class... TArgs> void BroadcastEvent(TDelegate& Event, TArgs&&... Args)
+	// Events are broadcast on the game thread, unless the subsystem is deinitialized by then.
+	template <class TDelegate, class... TArgs>
+	void BroadcastEvent(const UDolbyIOSubsystem& Subsystem, TDelegate& Event, TArgs&&... Args)
 	{
-		AsyncTask(ENamedThreads::GameThread, [=] { Event.Broadcast(Args...); });
+		FEventQueue::Enqueue(Subsystem, [=] { Event.Broadcast(Args...); });
+	}
+
+	template <class TDelegate, class... TArgs>
+	void BroadcastCoalescedEvent(const UDolbyIOSubsystem& Subsystem, TDelegate& Event, const FString& Key,
+	                             TArgs&&... Args)
+	{
+		FEventQueue::EnqueueCoalesced(Subsystem, &Event, Key, [=] { Event.Broadcast(Args...); });
+	}
+
+	// The native event is broadcast right after the Blueprint one, from the same queued call.
+	template <class TDelegate, class TNativeDelegate, class... TArgs>
+	void BroadcastEventWithNative(const UDolbyIOSubsystem& Subsystem, TDelegate& Event, TNativeDelegate& NativeEvent,
+	                              TArgs&&... Args)
+	{
+		FEventQueue::Enqueue(Subsystem,
+		                     [=]
+		                     {
+			                     Event.Broadcast(Args...);
+			                     NativeEvent.Broadcast(Args...);
+		                     });
+	}
+
+	template <class TDelegate, class TNativeDelegate, class... TArgs>
+	void BroadcastCoalescedEventWithNative(const UDolbyIOSubsystem& Subsystem, TDelegate& Event,
+	                                       TNativeDelegate& NativeEvent, const FString& Key, TArgs&&... Args)
+	{
+		FEventQueue::EnqueueCoalesced(Subsystem, &Event, Key,
+		                              [=]
+		                              {
+			                              Event.Broadcast(Args...);
+			                              NativeEvent.Broadcast(Args...);
+		                              });
 	}
 }
@@ -0,0 +1,116 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Utils/DolbyIOConnectionTimer.h"
+
+#include "Utils/DolbyIOLogging.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+namespace DolbyIO
+{
+	namespace
+	{
+		TAutoConsoleVariable<float> CVarReportTimeoutSeconds{
+		    TEXT("DolbyIO.Timings.ReportTimeoutSeconds"), 10.0f,
+		    TEXT("Time after joining after which connection timings are reported even if some stages were not "
+		         "reached, e.g. because nobody else is in the conference.")};
+
+		const TCHAR* ToString(FConnectionTimer::EStage Stage)
+		{
+			switch (Stage)
+			{
+				case FConnectionTimer::EStage::SessionOpen:
+					return TEXT("session open");
+				case FConnectionTimer::EStage::ConferenceCreate:
+					return TEXT("conference create");
+				case FConnectionTimer::EStage::Join:
+					return TEXT("join");
+				case FConnectionTimer::EStage::FirstRemoteParticipant:
+					return TEXT("first remote participant");
+				case FConnectionTimer::EStage::FirstRemoteVideoFrame:
+					return TEXT("first remote video frame");
+				case FConnectionTimer::EStage::FirstAudioLevel:
+					return TEXT("first audio level");
+				default:
+					return TEXT("unknown");
+			}
+		}
+	}
+
+	void FConnectionTimer::Start()
+	{
+		FScopeLock ScopeLock{&Lock};
+		Timings = {};
+		StartTime = FPlatformTime::Seconds();
+		JoinTime = 0.0;
+		bIsReported = false;
+	}
+
+	void FConnectionTimer::Record(EStage Stage)
+	{
+		const double Now = FPlatformTime::Seconds();
+		FScopeLock ScopeLock{&Lock};
+		float& Timing = GetTiming(Stage);
+		if (bIsReported || Timing >= 0.0f)
+		{
+			return;
+		}
+
+		Timing = (Now - StartTime) * 1000.0;
+		if (Stage == EStage::Join)
+		{
+			JoinTime = Now;
+		}
+		DLB_UE_LOG("Connection stage reached: %s after %.1f ms", ToString(Stage), Timing);
+	}
+
+	FDolbyIOConnectionTimings FConnectionTimer::GetTimings() const
+	{
+		FScopeLock ScopeLock{&Lock};
+		return Timings;
+	}
+
+	bool FConnectionTimer::ShouldReport(FDolbyIOConnectionTimings& OutTimings)
+	{
+		FScopeLock ScopeLock{&Lock};
+		if (bIsReported || JoinTime == 0.0)
+		{
+			return false;
+		}
+
+		bool bIsComplete = true;
+		for (int Stage = 0; Stage < static_cast<int>(EStage::Count); ++Stage)
+		{
+			bIsComplete &= GetTiming(static_cast<EStage>(Stage)) >= 0.0f;
+		}
+		if (!bIsComplete && FPlatformTime::Seconds() - JoinTime < CVarReportTimeoutSeconds.GetValueOnGameThread())
+		{
+			return false;
+		}
+
+		bIsReported = true;
+		OutTimings = Timings;
+		return true;
+	}
+
+	float& FConnectionTimer::GetTiming(EStage Stage)
+	{
+		switch (Stage)
+		{
+			case EStage::SessionOpen:
+				return Timings.SessionOpenMs;
+			case EStage::ConferenceCreate:
+				return Timings.ConferenceCreateMs;
+			case EStage::Join:
+				return Timings.JoinMs;
+			case EStage::FirstRemoteParticipant:
+				return Timings.FirstRemoteParticipantMs;
+			case EStage::FirstRemoteVideoFrame:
+				return Timings.FirstRemoteVideoFrameMs;
+			default:
+				return Timings.FirstAudioLevelMs;
+		}
+	}
+}
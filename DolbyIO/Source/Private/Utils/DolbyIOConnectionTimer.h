@@ -0,0 +1,44 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "DolbyIOTypes.h"
+
+#include "HAL/CriticalSection.h"
+
+namespace DolbyIO
+{
+	// Records when each stage of a connection is first reached. Stages are recorded from the SDK threads while the
+	// timings are reported from the game thread.
+	class FConnectionTimer final
+	{
+	public:
+		enum class EStage
+		{
+			SessionOpen,
+			ConferenceCreate,
+			Join,
+			FirstRemoteParticipant,
+			FirstRemoteVideoFrame,
+			FirstAudioLevel,
+			Count
+		};
+
+		void Start();
+		void Record(EStage Stage);
+
+		FDolbyIOConnectionTimings GetTimings() const;
+
+		// Returns the timings once when every stage has been reached or some time after joining, whichever is first.
+		bool ShouldReport(FDolbyIOConnectionTimings& OutTimings);
+
+	private:
+		float& GetTiming(EStage Stage);
+
+		FDolbyIOConnectionTimings Timings;
+		double StartTime = 0.0;
+		double JoinTime = 0.0;
+		bool bIsReported = true;
+		mutable FCriticalSection Lock;
+	};
+}
@@ -2,6 +2,9 @@
 
 #include "Utils/DolbyIOConversions.h"
 
+#include "Utils/DolbyIOIDTable.h"
+#include "Utils/DolbyIOTrace.h"
+
 namespace DolbyIO
 {
 	using namespace dolbyio::comms;
@@ -147,8 +150,10 @@ namespace DolbyIO
 
 	FDolbyIOParticipantInfo ToFDolbyIOParticipantInfo(const participant_info& Info)
 	{
+		DLB_TRACE_CPU_SCOPE(ToFDolbyIOParticipantInfo);
+
 		FDolbyIOParticipantInfo Ret{};
-		Ret.UserID = ToFString(Info.user_id);
+		Ret.UserID = FIDTable::ToFString(Info.user_id);
 		Ret.Name = ToFString(Info.info.name.value_or(""));
 		Ret.ExternalID = ToFString(Info.info.external_id.value_or(""));
 		Ret.AvatarURL = ToFString(Info.info.avatar_url.value_or(""));
@@ -162,8 +167,8 @@ namespace DolbyIO
 	FDolbyIOVideoTrack ToFDolbyIOVideoTrack(const dolbyio::comms::video_track& Track)
 	{
 		FDolbyIOVideoTrack Ret;
-		Ret.TrackID = ToFString(Track.sdp_track_id);
-		Ret.ParticipantID = ToFString(Track.peer_id);
+		Ret.TrackID = FIDTable::ToFString(Track.sdp_track_id);
+		Ret.ParticipantID = FIDTable::ToFString(Track.peer_id);
 		Ret.bIsScreenshare = Track.is_screenshare;
 		return Ret;
 	}
@@ -173,11 +178,11 @@ namespace DolbyIO
 	{
 		FDolbyIOVideoTrack Ret;
 #if PLATFORM_ANDROID // SDK 2.7
-		Ret.TrackID = ToFString(TrackMapItem.second.sdp_track_id);
+		Ret.TrackID = FIDTable::ToFString(TrackMapItem.second.sdp_track_id);
 #else // SDK 2.6
-		Ret.TrackID = ToFString(std::get<1>(TrackMapItem.second));
+		Ret.TrackID = FIDTable::ToFString(std::get<1>(TrackMapItem.second));
 #endif
-		Ret.ParticipantID = ToFString(TrackMapItem.first);
+		Ret.ParticipantID = FIDTable::ToFString(TrackMapItem.first);
 		Ret.bIsScreenshare = false;
 		return Ret;
 	}
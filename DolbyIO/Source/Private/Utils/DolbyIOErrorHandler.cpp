@@ -13,6 +13,68 @@ namespace DolbyIO
 {
 	using namespace dolbyio::comms;
 
+	namespace
+	{
+		const FDolbyIOOnErrorNativeDelegate* FindNativeErrorDelegate(const UDolbyIOSubsystem& DolbyIOSubsystem,
+		                                                             const FDolbyIOOnErrorDelegate& OnError)
+		{
+#define DLB_NATIVE_ERROR(Event)                 \
+	if (&OnError == &DolbyIOSubsystem.Event)    \
+	{                                           \
+		return &DolbyIOSubsystem.Event##Native; \
+	}
+			DLB_NATIVE_ERROR(OnSetTokenError)
+			DLB_NATIVE_ERROR(OnConnectError)
+			DLB_NATIVE_ERROR(OnWarmUpConnectionError)
+			DLB_NATIVE_ERROR(OnDemoConferenceError)
+			DLB_NATIVE_ERROR(OnDisconnectError)
+			DLB_NATIVE_ERROR(OnSetSpatialEnvironmentScaleError)
+			DLB_NATIVE_ERROR(OnMuteInputError)
+			DLB_NATIVE_ERROR(OnUnmuteInputError)
+			DLB_NATIVE_ERROR(OnMuteOutputError)
+			DLB_NATIVE_ERROR(OnUnmuteOutputError)
+			DLB_NATIVE_ERROR(OnMuteParticipantError)
+			DLB_NATIVE_ERROR(OnUnmuteParticipantError)
+			DLB_NATIVE_ERROR(OnEnableVideoError)
+			DLB_NATIVE_ERROR(OnDisableVideoError)
+			DLB_NATIVE_ERROR(OnGetScreenshareSourcesError)
+			DLB_NATIVE_ERROR(OnStartScreenshareError)
+			DLB_NATIVE_ERROR(OnStopScreenshareError)
+			DLB_NATIVE_ERROR(OnChangeScreenshareParametersError)
+			DLB_NATIVE_ERROR(OnGetCurrentScreenshareSourceError)
+			DLB_NATIVE_ERROR(OnSetLocalPlayerLocationError)
+			DLB_NATIVE_ERROR(OnSetLocalPlayerRotationError)
+			DLB_NATIVE_ERROR(OnSetRemotePlayerLocationError)
+			DLB_NATIVE_ERROR(OnSetLogSettingsError)
+			DLB_NATIVE_ERROR(OnGetAudioInputDevicesError)
+			DLB_NATIVE_ERROR(OnGetAudioOutputDevicesError)
+			DLB_NATIVE_ERROR(OnGetCurrentAudioInputDeviceError)
+			DLB_NATIVE_ERROR(OnGetCurrentAudioOutputDeviceError)
+			DLB_NATIVE_ERROR(OnSetAudioInputDeviceError)
+			DLB_NATIVE_ERROR(OnSetAudioOutputDeviceError)
+			DLB_NATIVE_ERROR(OnGetVideoDevicesError)
+			DLB_NATIVE_ERROR(OnGetCurrentVideoDeviceError)
+			DLB_NATIVE_ERROR(OnUpdateUserMetadataError)
+			DLB_NATIVE_ERROR(OnSetAudioCaptureModeError)
+			DLB_NATIVE_ERROR(OnSendMessageError)
+#undef DLB_NATIVE_ERROR
+			return nullptr;
+		}
+
+		void BroadcastError(const UDolbyIOSubsystem& DolbyIOSubsystem, const FDolbyIOOnErrorDelegate& OnError,
+		                    const FString& ErrorMsg)
+		{
+			if (const FDolbyIOOnErrorNativeDelegate* OnErrorNative = FindNativeErrorDelegate(DolbyIOSubsystem, OnError))
+			{
+				BroadcastEventWithNative(DolbyIOSubsystem, OnError, *OnErrorNative, ErrorMsg);
+			}
+			else
+			{
+				BroadcastEvent(DolbyIOSubsystem, OnError, ErrorMsg);
+			}
+		}
+	}
+
 	FErrorHandler::FErrorHandler(const FString& File, int Line, UDolbyIOSubsystem& DolbyIOSubsystem)
 	    : File(FPaths::GetCleanFilename(File)), Line(Line), DolbyIOSubsystem(DolbyIOSubsystem)
 	{
@@ -85,18 +147,18 @@ namespace DolbyIO
 
 	void FErrorHandler::HandleErrorOnGameThread(std::exception_ptr&& ExcPtr) const
 	{
-		AsyncTask(ENamedThreads::GameThread,
-		          [ExcP = MoveTemp(ExcPtr), CopySelf = *this]
-		          {
-			          try
-			          {
-				          std::rethrow_exception(ExcP);
-			          }
-			          catch (...)
-			          {
-				          CopySelf.HandleError();
-			          }
-		          });
+		FEventQueue::Enqueue(DolbyIOSubsystem,
+		                     [ExcP = MoveTemp(ExcPtr), CopySelf = *this]
+		                     {
+			                     try
+			                     {
+				                     std::rethrow_exception(ExcP);
+			                     }
+			                     catch (...)
+			                     {
+				                     CopySelf.HandleError();
+			                     }
+		                     });
 	}
 
 	void FErrorHandler::LogException(const FString& Type, const FString& What) const
@@ -106,13 +168,14 @@ namespace DolbyIO
 		                *ToString(DolbyIOSubsystem.ConferenceStatus), *File, Line);
 		if (OnError)
 		{
-			BroadcastEvent(*OnError, ErrorMsg);
+			BroadcastError(DolbyIOSubsystem, *OnError, ErrorMsg);
 		}
 	}
 
-	void FErrorHandler::Warn(const FDolbyIOOnErrorDelegate& OnError, const FString& Msg)
+	void FErrorHandler::Warn(const UDolbyIOSubsystem& DolbyIOSubsystem, const FDolbyIOOnErrorDelegate& OnError,
+	                         const FString& Msg)
 	{
 		DLB_UE_LOG_BASE(Warning, "%s", *Msg);
-		BroadcastEvent(OnError, Msg);
+		BroadcastError(DolbyIOSubsystem, OnError, Msg);
 	}
 }
@@ -0,0 +1,195 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Utils/DolbyIOEventQueue.h"
+
+#include "DolbyIO.h"
+#include "Utils/DolbyIOLLM.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace DolbyIO
+{
+	namespace
+	{
+		TAutoConsoleVariable<float> CVarFrameBudgetMs{
+		    TEXT("DolbyIO.Events.FrameBudgetMs"), 0.0f,
+		    TEXT("Maximum time spent broadcasting Dolby.io events per frame, 0 for no limit. Events left over are "
+		         "broadcast in the next frames.")};
+
+		TAutoConsoleVariable<bool> CVarCoalesce{
+		    TEXT("DolbyIO.Events.Coalesce"), false,
+		    TEXT("Only broadcast the latest participant update, audio levels and active speakers per participant "
+		         "and frame, dropping the superseded ones.")};
+
+		TUniquePtr<FEventQueue> Instance;
+	}
+
+	void FEventQueue::Startup()
+	{
+		Instance = MakeUnique<FEventQueue>();
+	}
+
+	void FEventQueue::Shutdown()
+	{
+		Instance.Reset();
+	}
+
+	bool FEventQueue::Enqueue(FEvent&& Event)
+	{
+		if (!Instance)
+		{
+			DLB_UE_LOG_BASE(Warning, "Dropping event raised while the event queue is not running");
+			return false;
+		}
+
+		DLB_LLM_SCOPE(DolbyIO);
+		++NumEnqueued;
+		TRACE_COUNTER_SET(DolbyIO_QueuedEvents, ++NumPending);
+		INC_DWORD_STAT(STAT_DolbyIO_PendingEvents);
+		Instance->Queue.Enqueue(MoveTemp(Event));
+		return true;
+	}
+
+	void FEventQueue::Enqueue(const UDolbyIOSubsystem& Owner, FEvent&& Event)
+	{
+		Enqueue(GuardedByOwner(Owner, MoveTemp(Event)));
+	}
+
+	void FEventQueue::EnqueueCoalesced(const UDolbyIOSubsystem& Owner, const void* Type, const FString& Key,
+	                                   FEvent&& Event)
+	{
+		Event = GuardedByOwner(Owner, MoveTemp(Event));
+		if (!Instance || !IsCoalescingEnabled())
+		{
+			Enqueue(MoveTemp(Event));
+			return;
+		}
+
+		DLB_LLM_SCOPE(DolbyIO);
+		FCoalesceKey CoalesceKey{Type, Key};
+		uint64 SlotID;
+		{
+			FScopeLock Lock{&Instance->CoalescedEventsLock};
+			const uint64* OpenSlotID = Instance->OpenSlotIDs.Find(CoalesceKey);
+			const uint64* LastSlotID = Instance->LastSlotIDs.Find(Key);
+			if (OpenSlotID && LastSlotID && *LastSlotID == *OpenSlotID)
+			{
+				Instance->CoalescedEvents[*OpenSlotID] = MoveTemp(Event);
+				++NumCollapsed;
+				INC_DWORD_STAT(STAT_DolbyIO_CollapsedEvents);
+				return;
+			}
+			SlotID = Instance->NextSlotID++;
+			Instance->CoalescedEvents.Emplace(SlotID, MoveTemp(Event));
+			Instance->OpenSlotIDs.Emplace(CoalesceKey, SlotID);
+			Instance->LastSlotIDs.Emplace(Key, SlotID);
+		}
+		Enqueue([CoalesceKey = MoveTemp(CoalesceKey), SlotID] { Instance->BroadcastCoalesced(CoalesceKey, SlotID); });
+	}
+
+	FEventQueue::FEvent FEventQueue::GuardedByOwner(const UDolbyIOSubsystem& Owner, FEvent&& Event)
+	{
+		return [WeakOwner = TWeakObjectPtr<const UDolbyIOSubsystem>(&Owner), Event = MoveTemp(Event)]
+		{
+			if (WeakOwner.IsValid() && !WeakOwner->bIsDeinitialized)
+			{
+				Event();
+			}
+		};
+	}
+
+	void FEventQueue::BroadcastCoalesced(const FCoalesceKey& CoalesceKey, uint64 SlotID)
+	{
+		FEvent Event;
+		{
+			FScopeLock Lock{&CoalescedEventsLock};
+			CoalescedEvents.RemoveAndCopyValue(SlotID, Event);
+			const uint64* OpenSlotID = OpenSlotIDs.Find(CoalesceKey);
+			if (OpenSlotID && *OpenSlotID == SlotID)
+			{
+				OpenSlotIDs.Remove(CoalesceKey);
+			}
+			const uint64* LastSlotID = LastSlotIDs.Find(CoalesceKey.Get<1>());
+			if (LastSlotID && *LastSlotID == SlotID)
+			{
+				LastSlotIDs.Remove(CoalesceKey.Get<1>());
+			}
+		}
+		if (Event)
+		{
+			Event();
+		}
+	}
+
+	void FEventQueue::Drain()
+	{
+		if (Instance)
+		{
+			Instance->DrainWithBudget(0.0);
+		}
+	}
+
+	bool FEventQueue::IsCoalescingEnabled()
+	{
+		return CVarCoalesce.GetValueOnAnyThread();
+	}
+
+	uint64 FEventQueue::GetNumEnqueued()
+	{
+		return NumEnqueued;
+	}
+
+	int64 FEventQueue::GetNumPending()
+	{
+		return NumPending;
+	}
+
+	uint64 FEventQueue::GetNumCollapsed()
+	{
+		return NumCollapsed;
+	}
+
+	void FEventQueue::Tick(float DeltaTime)
+	{
+		DrainWithBudget(CVarFrameBudgetMs.GetValueOnGameThread());
+	}
+
+	TStatId FEventQueue::GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FDolbyIOEventQueue, STATGROUP_Tickables);
+	}
+
+	void FEventQueue::DrainWithBudget(double BudgetMs)
+	{
+		if (Queue.IsEmpty())
+		{
+			return;
+		}
+
+		DLB_TRACE_CPU_SCOPE(BroadcastEvents);
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_BroadcastEvent);
+
+		const uint64 Deadline =
+		    BudgetMs > 0.0 ? FPlatformTime::Cycles64() + BudgetMs / FPlatformTime::ToMilliseconds64(1) : MAX_uint64;
+		uint32 NumDrained = 0;
+		FEvent Event;
+		while (Queue.Dequeue(Event))
+		{
+			Event();
+			++NumDrained;
+			--NumPending;
+			if (FPlatformTime::Cycles64() >= Deadline)
+			{
+				break;
+			}
+		}
+
+		TRACE_COUNTER_SET(DolbyIO_QueuedEvents, NumPending);
+		DEC_DWORD_STAT_BY(STAT_DolbyIO_PendingEvents, NumDrained);
+		INC_DWORD_STAT_BY(STAT_DolbyIO_EventsBroadcast, NumDrained);
+	}
+}
@@ -0,0 +1,81 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
+#include "Tickable.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#include <atomic>
+
+class UDolbyIOSubsystem;
+
+namespace DolbyIO
+{
+	// Events raised on SDK threads are pushed to a lock-free multi-producer queue and broadcast on the game thread
+	// in one batch per frame, instead of creating a task graph task for each event.
+	class FEventQueue final : public FTickableGameObject
+	{
+	public:
+		using FEvent = TFunction<void()>;
+
+		static void Startup();
+		static void Shutdown();
+
+		// Returns false if the queue is not running, in which case the event is dropped.
+		static bool Enqueue(FEvent&& Event);
+		// Events raised on behalf of a subsystem are dropped if it is deinitialized before they are broadcast.
+		static void Enqueue(const UDolbyIOSubsystem& Owner, FEvent&& Event);
+		// If DolbyIO.Events.Coalesce is enabled, an event that has not been broadcast yet is replaced by a later event
+		// with the same type and key, so only the latest state is broadcast. An event is only replaced while no event
+		// of another type was queued for the key since, so events with the same key keep their order. Uncoalesced
+		// events carry no key and do not prevent replacing, so everything an event implies for its key, such as
+		// follow-up events, has to be broadcast from the coalesced event itself.
+		static void EnqueueCoalesced(const UDolbyIOSubsystem& Owner, const void* Type, const FString& Key,
+		                             FEvent&& Event);
+		static void Drain();
+
+		static bool IsCoalescingEnabled();
+
+		static uint64 GetNumEnqueued();
+		static int64 GetNumPending();
+		static uint64 GetNumCollapsed();
+
+	private:
+		void Tick(float DeltaTime) override;
+		TStatId GetStatId() const override;
+		ETickableTickType GetTickableTickType() const override
+		{
+			return ETickableTickType::Always;
+		}
+		bool IsTickableWhenPaused() const override
+		{
+			return true;
+		}
+		bool IsTickableInEditor() const override
+		{
+			return true;
+		}
+
+		void DrainWithBudget(double BudgetMs);
+
+		static FEvent GuardedByOwner(const UDolbyIOSubsystem& Owner, FEvent&& Event);
+
+		using FCoalesceKey = TTuple<const void*, FString>;
+		void BroadcastCoalesced(const FCoalesceKey& CoalesceKey, uint64 SlotID);
+
+		TQueue<FEvent, EQueueMode::Mpsc> Queue;
+		// Queued coalesced events by slot, the slot still accepting replacements for each type and key, and the last
+		// slot queued for each key.
+		TMap<uint64, FEvent> CoalescedEvents;
+		TMap<FCoalesceKey, uint64> OpenSlotIDs;
+		TMap<FString, uint64> LastSlotIDs;
+		uint64 NextSlotID = 0;
+		FCriticalSection CoalescedEventsLock;
+
+		static inline std::atomic<uint64> NumEnqueued{0};
+		static inline std::atomic<int64> NumPending{0};
+		static inline std::atomic<uint64> NumCollapsed{0};
+	};
+}
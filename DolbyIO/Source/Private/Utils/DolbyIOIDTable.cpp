@@ -0,0 +1,126 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Utils/DolbyIOIDTable.h"
+
+#include "Utils/DolbyIOConversions.h"
+
+#include "Misc/ScopeRWLock.h"
+
+#include <unordered_map>
+
+namespace DolbyIO
+{
+	namespace
+	{
+		struct FEntry
+		{
+			std::string StdString;
+			FString String;
+		};
+
+		// FString comparison is case-insensitive by default, while IDs, like their std::string lookup, are not
+		struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, FIDHandle>, FString, false>
+		{
+			static const FString& GetSetKey(const TPair<FString, FIDHandle>& Element)
+			{
+				return Element.Key;
+			}
+			static bool Matches(const FString& A, const FString& B)
+			{
+				return A.Equals(B, ESearchCase::CaseSensitive);
+			}
+			static uint32 GetKeyHash(const FString& Key)
+			{
+				return FCrc::StrCrc32(*Key);
+			}
+		};
+
+		FRWLock Lock;
+		TArray<TUniquePtr<FEntry>> Entries; // Entries[Handle - 1]
+		std::unordered_map<std::string, FIDHandle> StdStringHandles;
+		TMap<FString, FIDHandle, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> StringHandles;
+		const FEntry InvalidEntry;
+
+		FIDHandle Add(std::string&& StdString, FString&& String)
+		{
+			Entries.Emplace(MakeUnique<FEntry>(FEntry{MoveTemp(StdString), MoveTemp(String)}));
+			const FIDHandle Handle = Entries.Num();
+			StdStringHandles.emplace(Entries.Last()->StdString, Handle);
+			StringHandles.Emplace(Entries.Last()->String, Handle);
+			return Handle;
+		}
+
+		const FEntry& GetEntry(FIDHandle Handle)
+		{
+			FReadScopeLock ReadLock{Lock};
+			return Handle != InvalidIDHandle ? *Entries[Handle - 1] : InvalidEntry;
+		}
+	}
+
+	FIDHandle FIDTable::Intern(const std::string& ID)
+	{
+		{
+			FReadScopeLock ReadLock{Lock};
+			const auto It = StdStringHandles.find(ID);
+			if (It != StdStringHandles.end())
+			{
+				return It->second;
+			}
+		}
+
+		FWriteScopeLock WriteLock{Lock};
+		const auto It = StdStringHandles.find(ID);
+		return It != StdStringHandles.end() ? It->second : Add(std::string{ID}, DolbyIO::ToFString(ID));
+	}
+
+	FIDHandle FIDTable::Intern(const FString& ID)
+	{
+		{
+			FReadScopeLock ReadLock{Lock};
+			if (const FIDHandle* Handle = StringHandles.Find(ID))
+			{
+				return *Handle;
+			}
+		}
+
+		FWriteScopeLock WriteLock{Lock};
+		if (const FIDHandle* Handle = StringHandles.Find(ID))
+		{
+			return *Handle;
+		}
+		return Add(DolbyIO::ToStdString(ID), FString{ID});
+	}
+
+	FIDHandle FIDTable::Find(const FString& ID)
+	{
+		FReadScopeLock ReadLock{Lock};
+		const FIDHandle* Handle = StringHandles.Find(ID);
+		return Handle ? *Handle : InvalidIDHandle;
+	}
+
+	const FString& FIDTable::ToFString(FIDHandle Handle)
+	{
+		return GetEntry(Handle).String;
+	}
+
+	const std::string& FIDTable::ToStdString(FIDHandle Handle)
+	{
+		return GetEntry(Handle).StdString;
+	}
+
+	const FString& FIDTable::ToFString(const std::string& ID)
+	{
+		return ToFString(Intern(ID));
+	}
+
+	const std::string& FIDTable::ToStdString(const FString& ID)
+	{
+		return ToStdString(Intern(ID));
+	}
+
+	int FIDTable::Num()
+	{
+		FReadScopeLock ReadLock{Lock};
+		return Entries.Num();
+	}
+}
@@ -0,0 +1,32 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "DolbyIO.h"
+
+#include <string>
+
+namespace DolbyIO
+{
+	constexpr FIDHandle InvalidIDHandle = 0;
+
+	// Process-wide table of participant and track IDs. Each ID is transcoded once, when it is first seen, and from then
+	// on is referred to by a compact handle which is cheap to hash and copy. Handles are dense, starting from 1, and
+	// are never reused, so IDs stay valid (and their strings stay at the same address) until the module is unloaded.
+	class FIDTable
+	{
+	public:
+		static FIDHandle Intern(const std::string& ID);
+		static FIDHandle Intern(const FString& ID);
+		// Returns InvalidIDHandle if the ID has never been interned.
+		static FIDHandle Find(const FString& ID);
+
+		static const FString& ToFString(FIDHandle Handle);
+		static const std::string& ToStdString(FIDHandle Handle);
+		// Shorthands for interning an ID and converting it to the other string type.
+		static const FString& ToFString(const std::string& ID);
+		static const std::string& ToStdString(const FString& ID);
+
+		static int Num();
+	};
+}
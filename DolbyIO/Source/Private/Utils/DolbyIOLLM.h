@@ -0,0 +1,19 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "HAL/LowLevelMemTracker.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+// Run with -llm to see these in "stat LLM" and "stat LLMFULL", or with -trace=memtag in Unreal Insights.
+#if ENGINE_MAJOR_VERSION == 5
+LLM_DECLARE_TAG(DolbyIO);
+LLM_DECLARE_TAG(DolbyIO_VideoBuffers);
+LLM_DECLARE_TAG(DolbyIO_Textures);
+LLM_DECLARE_TAG(DolbyIO_SdkInternal);
+
+#define DLB_LLM_SCOPE(Tag) LLM_SCOPE_BYTAG(Tag)
+#else
+// UE4 only supports the built-in ELLMTag values, so nothing is tagged there.
+#define DLB_LLM_SCOPE(Tag)
+#endif
@@ -0,0 +1,94 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Utils/DolbyIOSdkAllocator.h"
+
+#include "Utils/DolbyIOLLM.h"
+#include "Utils/DolbyIOStats.h"
+
+#include "HAL/UnrealMemory.h"
+
+#include <atomic>
+
+#define DLB_TRACK_SDK_ALLOCATIONS (STATS || DOLBYIO_WITH_BENCHMARKS)
+
+namespace DolbyIO
+{
+	namespace
+	{
+		std::atomic<uint64> NumAllocations{0};
+		std::atomic<uint64> NumPublishedAllocations{0};
+		std::atomic<uint64> LiveBytes{0};
+		std::atomic<uint64> PeakBytes{0};
+
+		void UpdatePeak(uint64 Live)
+		{
+			uint64 Peak = PeakBytes.load(std::memory_order_relaxed);
+			while (Live > Peak && !PeakBytes.compare_exchange_weak(Peak, Live, std::memory_order_relaxed))
+			{
+			}
+		}
+	}
+
+	dolbyio::comms::app_allocator FSdkAllocator::Get()
+	{
+		return {[](std::size_t Count) { return Allocate(Count, DEFAULT_ALIGNMENT); },
+		        [](std::size_t Count, std::size_t Alignment) { return Allocate(Count, Alignment); },
+		        [](void* Ptr) { Free(Ptr); },
+		        [](void* Ptr, std::size_t) { Free(Ptr); }};
+	}
+
+	uint64 FSdkAllocator::GetNumAllocations()
+	{
+		return NumAllocations.load(std::memory_order_relaxed);
+	}
+
+	uint64 FSdkAllocator::GetLiveBytes()
+	{
+		return LiveBytes.load(std::memory_order_relaxed);
+	}
+
+	uint64 FSdkAllocator::GetPeakBytes()
+	{
+		return PeakBytes.load(std::memory_order_relaxed);
+	}
+
+	void* FSdkAllocator::Allocate(std::size_t Count, std::size_t Alignment)
+	{
+		DLB_LLM_SCOPE(DolbyIO_SdkInternal);
+		void* Ptr = FMemory::Malloc(Count ? Count : 1, Alignment);
+		if (!Ptr)
+		{
+			throw std::bad_alloc{};
+		}
+
+#if DLB_TRACK_SDK_ALLOCATIONS
+		const SIZE_T Size = FMemory::GetAllocSize(Ptr);
+		NumAllocations.fetch_add(1, std::memory_order_relaxed);
+		UpdatePeak(LiveBytes.fetch_add(Size, std::memory_order_relaxed) + Size);
+#endif
+		return Ptr;
+	}
+
+	void FSdkAllocator::Free(void* Ptr)
+	{
+		if (!Ptr)
+		{
+			return;
+		}
+
+#if DLB_TRACK_SDK_ALLOCATIONS
+		LiveBytes.fetch_sub(FMemory::GetAllocSize(Ptr), std::memory_order_relaxed);
+#endif
+		FMemory::Free(Ptr);
+	}
+
+	void FSdkAllocator::PublishStats()
+	{
+#if STATS
+		const uint64 Num = GetNumAllocations();
+		INC_DWORD_STAT_BY(STAT_DolbyIO_SdkAllocations, Num - NumPublishedAllocations.exchange(Num));
+		SET_MEMORY_STAT(STAT_DolbyIO_SdkMemory, GetLiveBytes());
+		SET_MEMORY_STAT(STAT_DolbyIO_SdkPeakMemory, GetPeakBytes());
+#endif
+	}
+}
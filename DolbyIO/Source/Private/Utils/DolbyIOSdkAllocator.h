@@ -0,0 +1,27 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Utils/DolbyIOCppSdk.h"
+
+namespace DolbyIO
+{
+	// Routes the SDK's allocations through FMemory, i.e. the engine's binned allocator with its per-thread caches,
+	// instead of the C runtime heap, and keeps track of how much the SDK allocates in builds with stats or benchmarks.
+	// The counters are only atomics on the allocation path and are published to the stats system once per frame.
+	class FSdkAllocator final
+	{
+	public:
+		static dolbyio::comms::app_allocator Get();
+
+		static uint64 GetNumAllocations();
+		static uint64 GetLiveBytes();
+		static uint64 GetPeakBytes();
+
+		static void PublishStats();
+
+	private:
+		static void* Allocate(std::size_t Count, std::size_t Alignment);
+		static void Free(void* Ptr);
+	};
+}
@@ -0,0 +1,34 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+// Use "stat DolbyIO" to display these in game.
+DECLARE_STATS_GROUP(TEXT("DolbyIO"), STATGROUP_DolbyIO, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Convert frame"), STAT_DolbyIO_ConvertFrame, STATGROUP_DolbyIO, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Upload texture"), STAT_DolbyIO_UploadTexture, STATGROUP_DolbyIO, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Broadcast events"), STAT_DolbyIO_BroadcastEvent, STATGROUP_DolbyIO, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Events broadcast per frame"), STAT_DolbyIO_EventsBroadcast, STATGROUP_DolbyIO,
+                                  );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Events collapsed per frame"), STAT_DolbyIO_CollapsedEvents, STATGROUP_DolbyIO,
+                                  );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("SDK allocations per frame"), STAT_DolbyIO_SdkAllocations, STATGROUP_DolbyIO, );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active video sinks"), STAT_DolbyIO_ActiveSinks, STATGROUP_DolbyIO, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Materials bound"), STAT_DolbyIO_MaterialsBound, STATGROUP_DolbyIO, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Remote participants"), STAT_DolbyIO_RemoteParticipants, STATGROUP_DolbyIO,
+                                      );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending events"), STAT_DolbyIO_PendingEvents, STATGROUP_DolbyIO, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spatial updates per second"), STAT_DolbyIO_SpatialUpdatesPerSecond,
+                                      STATGROUP_DolbyIO, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Culled participants"), STAT_DolbyIO_CulledParticipants, STATGROUP_DolbyIO,
+                                      );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last join time (ms)"), STAT_DolbyIO_JoinTime, STATGROUP_DolbyIO, );
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Frame buffers"), STAT_DolbyIO_FrameBufferMemory, STATGROUP_DolbyIO, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Textures"), STAT_DolbyIO_TextureMemory, STATGROUP_DolbyIO, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("SDK live"), STAT_DolbyIO_SdkMemory, STATGROUP_DolbyIO, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("SDK peak"), STAT_DolbyIO_SdkPeakMemory, STATGROUP_DolbyIO, );
@@ -0,0 +1,18 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Trace/Trace.h"
+
+// Enable with -trace=cpu,dolbyio to see the plugin's scopes in Unreal Insights.
+UE_TRACE_CHANNEL_EXTERN(DolbyIOChannel)
+
+#define DLB_TRACE_CPU_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(DolbyIO_##Name, DolbyIOChannel)
+#define DLB_TRACE_CPU_SCOPE_STR(NameStr) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(NameStr, DolbyIOChannel)
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(DolbyIO_VideoTracks);
+TRACE_DECLARE_INT_COUNTER_EXTERN(DolbyIO_QueuedEvents);
+TRACE_DECLARE_INT_COUNTER_EXTERN(DolbyIO_FramesInFlight);
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Utils/DolbyIOCppSdk.h"
+#include "Utils/DolbyIOTrace.h"
 
 namespace DolbyIO
 {
@@ -37,6 +38,7 @@ namespace DolbyIO
 
 		void handle_frame(const dolbyio::comms::video_frame& VideoFrame) override
 		{
+			DLB_TRACE_CPU_SCOPE(VideoProcessing_HandleFrame);
 			if (SdkSink)
 			{
 				SdkSink->handle_frame(VideoFrame);
@@ -3,11 +3,14 @@
 #include "DolbyIOVideoSink.h"
 
 #include "DolbyIOVideoTexture.h"
+#include "Utils/DolbyIOEventQueue.h"
+#include "Utils/DolbyIOLLM.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
 
 #include <dolbyio/comms/media_engine/video_utils.h>
 
-#include "Async/Async.h"
 #include "Engine/Texture2D.h"
 #include "Materials/MaterialInstanceDynamic.h"
 
@@ -27,6 +30,11 @@ namespace DolbyIO
 
 	FVideoSink::FVideoSink(const FString& VideoTrackID) : VideoTrackID(VideoTrackID) {}
 
+	FVideoSink::~FVideoSink()
+	{
+		DEC_DWORD_STAT_BY(STAT_DolbyIO_MaterialsBound, Materials.Num());
+	}
+
 	void FVideoSink::OnTextureCreated(FOnTextureCreated OnTextureCreated)
 	{
 		if (Texture)
@@ -46,7 +54,12 @@ namespace DolbyIO
 		if (IsValid(Material))
 		{
 			DLB_UE_LOG("Binding material %u to video track ID %s", Material->GetUniqueID(), *VideoTrackID);
-			Materials.Add(Material);
+			bool bIsAlreadyBound;
+			Materials.Add(Material, &bIsAlreadyBound);
+			if (!bIsAlreadyBound)
+			{
+				INC_DWORD_STAT(STAT_DolbyIO_MaterialsBound);
+			}
 			if (Texture)
 			{
 				Material->SetTextureParameterValue(TexParamName, GetTexture());
@@ -56,7 +69,13 @@ namespace DolbyIO
 
 	void FVideoSink::UnbindMaterial(UMaterialInstanceDynamic* Material)
 	{
-		if (Materials.Remove(Material) && IsValid(Material))
+		if (!Materials.Remove(Material))
+		{
+			return;
+		}
+
+		DEC_DWORD_STAT(STAT_DolbyIO_MaterialsBound);
+		if (IsValid(Material))
 		{
 			DLB_UE_LOG("Unbinding material %u from video track ID %s", Material->GetUniqueID(), *VideoTrackID);
 			UnbindMaterialImpl(*Material);
@@ -65,17 +84,17 @@ namespace DolbyIO
 
 	void FVideoSink::UnbindAllMaterials()
 	{
-		AsyncTask(ENamedThreads::GameThread,
-		          [MaterialsArray = Materials.Array()]
-		          {
-			          for (UMaterialInstanceDynamic* Material : MaterialsArray)
-			          {
-				          if (IsValid(Material))
-				          {
-					          UnbindMaterialImpl(*Material);
-				          }
-			          }
-		          });
+		FEventQueue::Enqueue(
+		    [MaterialsArray = Materials.Array()]
+		    {
+			    for (UMaterialInstanceDynamic* Material : MaterialsArray)
+			    {
+				    if (IsValid(Material))
+				    {
+					    UnbindMaterialImpl(*Material);
+				    }
+			    }
+		    });
 	}
 
 	void FVideoSink::Disable()
@@ -85,36 +104,69 @@ namespace DolbyIO
 
 	void FVideoSink::handle_frame(const video_frame& VideoFrame)
 	{
+		HandleFrame(VideoFrame.width(), VideoFrame.height(), [&] { Convert(VideoFrame); });
+	}
+
+#if DOLBYIO_WITH_FAKE_BACKEND
+	void FVideoSink::HandleSyntheticFrame(int Width, int Height, FFillFrame FillFrame)
+	{
+		HandleFrame(Width, Height,
+		            [&]
+		            {
+			            SCOPE_CYCLE_COUNTER(STAT_DolbyIO_ConvertFrame);
+			            FScopeLock Lock{Texture->GetBufferLock()};
+			            FillFrame(Texture->GetBuffer(), Width * FVideoTexture::Stride);
+		            });
+	}
+#endif
+
+	void FVideoSink::HandleFrame(int Width, int Height, TFunctionRef<void()> ConvertFrame)
+	{
+		DLB_TRACE_CPU_SCOPE(VideoSink_HandleFrame);
+		DLB_LLM_SCOPE(DolbyIO_VideoBuffers);
+
 		if (!bIsEnabled)
 		{
 			return;
 		}
 
-		!Texture ? CreateTexture(VideoFrame.width(), VideoFrame.height())
-		         : ResizeTexture(VideoFrame.width(), VideoFrame.height());
-		Convert(VideoFrame);
-		AsyncTask(ENamedThreads::GameThread, [Tex = this->Texture] { Tex->Render(); });
+		!Texture ? CreateTexture(Width, Height) : ResizeTexture(Width, Height);
+		if (!Texture)
+		{
+			return;
+		}
+		ConvertFrame();
+		FEventQueue::Enqueue([Tex = this->Texture, Frame = MakeShared<FFrameInFlight, ESPMode::ThreadSafe>()]
+		                     { Tex->Render(Frame); });
 	}
 
 	void FVideoSink::CreateTexture(int Width, int Height)
 	{
+		DLB_TRACE_CPU_SCOPE(VideoSink_CreateTexture);
 		FEvent* TexCreated = FGenericPlatformProcess::GetSynchEventFromPool();
-		AsyncTask(ENamedThreads::GameThread,
-		          [=]
-		          {
-			          Texture = MakeShared<FVideoTexture>(Width, Height);
-			          TexCreated->Trigger();
-
-			          for (UMaterialInstanceDynamic* Material : Materials)
-			          {
-				          if (IsValid(Material))
-				          {
-					          Material->SetTextureParameterValue(TexParamName, GetTexture());
-				          }
-			          }
-		          });
-		TexCreated->Wait();
+		const bool bIsQueued = FEventQueue::Enqueue(
+		    [=]
+		    {
+			    Texture = MakeShared<FVideoTexture>(Width, Height);
+			    TexCreated->Trigger();
+
+			    for (UMaterialInstanceDynamic* Material : Materials)
+			    {
+				    if (IsValid(Material))
+				    {
+					    Material->SetTextureParameterValue(TexParamName, GetTexture());
+				    }
+			    }
+		    });
+		if (bIsQueued)
+		{
+			TexCreated->Wait();
+		}
 		FGenericPlatformProcess::ReturnSynchEventToPool(TexCreated);
+		if (!bIsQueued) // shutting down, the frame is dropped
+		{
+			return;
+		}
 		OnTexCreated();
 		DLB_UE_LOG("Created texture %u for video track ID %s %dx%d", GetTexture()->GetUniqueID(), *VideoTrackID, Width,
 		           Height);
@@ -124,17 +176,20 @@ namespace DolbyIO
 	{
 		if (Texture->Resize(Width, Height))
 		{
-			AsyncTask(ENamedThreads::GameThread,
-			          [=, Tex = this->Texture]
-			          {
-				          DLB_UE_LOG("Resizing texture %u: old %dx%d new %dx%d", Tex->GetTexture()->GetUniqueID(),
-				                     Tex->GetTexture()->GetSizeX(), Tex->GetTexture()->GetSizeY(), Width, Height);
-			          });
+			FEventQueue::Enqueue(
+			    [=, Tex = this->Texture]
+			    {
+				    DLB_UE_LOG("Resizing texture %u: old %dx%d new %dx%d", Tex->GetTexture()->GetUniqueID(),
+				               Tex->GetTexture()->GetSizeX(), Tex->GetTexture()->GetSizeY(), Width, Height);
+			    });
 		}
 	}
 
 	void FVideoSink::Convert(const video_frame& VideoFrame)
 	{
+		DLB_TRACE_CPU_SCOPE(VideoSink_Convert);
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_ConvertFrame);
+
 		std::shared_ptr<video_frame_buffer> VideoFrameBuffer = VideoFrame.video_frame_buffer();
 
 		if (!VideoFrameBuffer)
@@ -17,6 +17,7 @@ namespace DolbyIO
 
 	public:
 		FVideoSink(const FString& VideoTrackID);
+		~FVideoSink();
 
 		void OnTextureCreated(FOnTextureCreated OnTextureCreated);
 
@@ -26,8 +27,14 @@ namespace DolbyIO
 		void UnbindAllMaterials();
 		void Disable();
 
+#if DOLBYIO_WITH_FAKE_BACKEND
+		using FFillFrame = TFunctionRef<void(uint8* Buffer, int Stride)>;
+		void HandleSyntheticFrame(int Width, int Height, FFillFrame FillFrame);
+#endif
+
 	private:
 		void handle_frame(const dolbyio::comms::video_frame&) override;
+		void HandleFrame(int Width, int Height, TFunctionRef<void()> ConvertFrame);
 
 		void CreateTexture(int Width, int Height);
 		void ResizeTexture(int Width, int Height);
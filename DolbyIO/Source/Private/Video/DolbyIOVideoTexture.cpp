@@ -2,6 +2,10 @@
 
 #include "DolbyIOVideoTexture.h"
 
+#include "Utils/DolbyIOLLM.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+
 #include "Engine/Texture2D.h"
 #include "RenderingThread.h"
 #include "Runtime/Launch/Resources/Version.h"
@@ -9,16 +13,28 @@
 
 namespace DolbyIO
 {
-	FVideoTexture::FVideoTexture(int Width, int Height) : Texture(UTexture2D::CreateTransient(Width, Height))
+	namespace
+	{
+		UTexture2D* CreateTransientTexture(int Width, int Height)
+		{
+			DLB_LLM_SCOPE(DolbyIO_Textures);
+			return UTexture2D::CreateTransient(Width, Height);
+		}
+	}
+
+	FVideoTexture::FVideoTexture(int Width, int Height) : Texture(CreateTransientTexture(Width, Height))
 	{
 		Texture->AddToRoot();
 		Texture->UpdateResource();
+		SetTextureMemory(Width, Height);
 		Resize(Width, Height);
 	}
 
 	FVideoTexture::~FVideoTexture()
 	{
 		Texture->RemoveFromRoot();
+		DEC_MEMORY_STAT_BY(STAT_DolbyIO_FrameBufferMemory, Buffer.GetAllocatedSize());
+		DEC_MEMORY_STAT_BY(STAT_DolbyIO_TextureMemory, TextureMemory);
 	}
 
 	UTexture2D* FVideoTexture::GetTexture()
@@ -37,10 +53,20 @@ namespace DolbyIO
 
 		Width = InWidth;
 		Height = InHeight;
+		DLB_LLM_SCOPE(DolbyIO_VideoBuffers);
+		const SIZE_T OldBufferMemory = Buffer.GetAllocatedSize();
 		Buffer.Reserve(Width * Height * Stride);
+		INC_MEMORY_STAT_BY(STAT_DolbyIO_FrameBufferMemory, Buffer.GetAllocatedSize() - OldBufferMemory);
 		return true;
 	}
 
+	void FVideoTexture::SetTextureMemory(int InWidth, int InHeight)
+	{
+		DEC_MEMORY_STAT_BY(STAT_DolbyIO_TextureMemory, TextureMemory);
+		TextureMemory = static_cast<SIZE_T>(InWidth) * InHeight * Stride;
+		INC_MEMORY_STAT_BY(STAT_DolbyIO_TextureMemory, TextureMemory);
+	}
+
 	FCriticalSection* FVideoTexture::GetBufferLock()
 	{
 		return &BufferLock;
@@ -96,18 +122,35 @@ namespace DolbyIO
 		};
 	}
 
-	void FVideoTexture::Render()
+	FFrameInFlight::FFrameInFlight()
+	{
+		TRACE_COUNTER_INCREMENT(DolbyIO_FramesInFlight);
+	}
+
+	FFrameInFlight::~FFrameInFlight()
 	{
+		TRACE_COUNTER_DECREMENT(DolbyIO_FramesInFlight);
+	}
+
+	void FVideoTexture::Render(const FFrameInFlightRef& Frame)
+	{
+		DLB_TRACE_CPU_SCOPE(VideoTexture_Render);
+
 		if (Texture->GetSizeX() != Width || Texture->GetSizeY() != Height)
 		{
+			DLB_LLM_SCOPE(DolbyIO_Textures);
 			FLockedTexture Tex{*Texture};
 			Tex.Resize(Width, Height);
+			SetTextureMemory(Width, Height);
 		}
 
 		ENQUEUE_RENDER_COMMAND(DolbyIOUpdateTexture)
 		(
-		    [SharedThis = AsShared()](FRHICommandListImmediate& RHICmdList)
+		    [SharedThis = AsShared(), Frame](FRHICommandListImmediate& RHICmdList)
 		    {
+			    DLB_TRACE_CPU_SCOPE(VideoTexture_Upload);
+			    SCOPE_CYCLE_COUNTER(STAT_DolbyIO_UploadTexture);
+			    DLB_LLM_SCOPE(DolbyIO_Textures);
 			    FScopeLock Lock{SharedThis->GetBufferLock()};
 			    auto FRHITexture2D_Ptr = SharedThis->Texture->GetResource()->GetTexture2DRHI();
 			    uint32 SizeX = FRHITexture2D_Ptr->GetSizeX(), SizeY = FRHITexture2D_Ptr->GetSizeY();	
@@ -121,7 +164,8 @@ namespace DolbyIO
 	{
 		UTexture2D* CreateEmptyTexture()
 		{
-			UTexture2D* Ret = UTexture2D::CreateTransient(1, 1);
+			DLB_LLM_SCOPE(DolbyIO_Textures);
+			UTexture2D* Ret = CreateTransientTexture(1, 1);
 			Ret->AddToRoot();
 			FLockedTexture Tex{*Ret};
 			Tex.Clear();
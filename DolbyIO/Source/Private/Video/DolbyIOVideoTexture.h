@@ -9,6 +9,16 @@ class UTexture2D;
 
 namespace DolbyIO
 {
+	// Counts a frame as in flight from its conversion until the last reference to it is released, which happens
+	// after its upload or when a queued render is dropped without running.
+	class FFrameInFlight final
+	{
+	public:
+		FFrameInFlight();
+		~FFrameInFlight();
+	};
+	using FFrameInFlightRef = TSharedRef<FFrameInFlight, ESPMode::ThreadSafe>;
+
 	class FVideoTexture final : public TSharedFromThis<FVideoTexture>
 	{
 	public:
@@ -20,17 +30,20 @@ namespace DolbyIO
 		bool Resize(int Width, int Height);
 		FCriticalSection* GetBufferLock();
 		uint8* GetBuffer();
-		void Render();
+		void Render(const FFrameInFlightRef& Frame);
 
 		static UTexture2D* GetEmptyTexture();
 
 		static constexpr int Stride = 4;
 
 	private:
+		void SetTextureMemory(int Width, int Height);
+
 		UTexture2D* const Texture;
 		TArray<uint8> Buffer;
 		FCriticalSection BufferLock;
 		int Width;
 		int Height;
+		SIZE_T TextureMemory = 0;
 	};
 }
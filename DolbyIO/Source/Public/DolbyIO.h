@@ -4,10 +4,13 @@
 
 #include "Components/ActorComponent.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
 
 #include "DolbyIOCppSdkFwd.h"
 #include "DolbyIOTypes.h"
 
+#include <atomic>
+#include <exception>
 #include <memory>
 
 #include "DolbyIO.generated.h"
@@ -27,6 +30,20 @@ const FString&, ConferenceID);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE
 (FDolbyIOOnDisconnectedDelegate);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam
+(FDolbyIOOnConnectionTimingsDelegate,
+const FDolbyIOConnectionTimings&, ConnectionTimings);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams
+(FDolbyIOOnReconnectingDelegate,
+int, Attempt,
+float, DelaySeconds);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams
+(FDolbyIOOnReconnectedDelegate,
+int, Attempts,
+float, DurationSeconds);
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams
 (FDolbyIOOnParticipantAddedDelegate,
 const EDolbyIOParticipantStatus, Status,
@@ -86,6 +103,14 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam
 (FDolbyIOOnActiveSpeakersChangedDelegate,
 const TArray<FString>&, ActiveSpeakers);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam
+(FDolbyIOOnSpeakerStartedDelegate,
+const FString&, ParticipantID);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam
+(FDolbyIOOnSpeakerStoppedDelegate,
+const FString&, ParticipantID);
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams
 (FDolbyIOOnAudioLevelsChangedDelegate,
 const TArray<FString>&, ActiveSpeakers,
@@ -147,20 +172,69 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam
 const FString&, ErrorMsg);
 // clang-format on
 
+// Native counterparts of the events above for C++ code, broadcast together with them but without reflection.
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnConnectedNativeDelegate, const FString& /* LocalParticipantID */,
+                                     const FString& /* ConferenceID */);
+DECLARE_MULTICAST_DELEGATE(FDolbyIOOnDisconnectedNativeDelegate);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnConnectionTimingsNativeDelegate, const FDolbyIOConnectionTimings&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnReconnectingNativeDelegate, int /* Attempt */,
+                                     float /* DelaySeconds */);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnReconnectedNativeDelegate, int /* Attempts */,
+                                     float /* DurationSeconds */);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnParticipantStatusNativeDelegate, EDolbyIOParticipantStatus,
+                                     const FDolbyIOParticipantInfo&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnParticipantNativeDelegate, const FDolbyIOParticipantInfo&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnVideoTrackNativeDelegate, const FDolbyIOVideoTrack&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnActiveSpeakersChangedNativeDelegate,
+                                    const TArray<FString>& /* ActiveSpeakers */);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnSpeakerNativeDelegate, const FString& /* ParticipantID */);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnAudioLevelsChangedNativeDelegate,
+                                     const TArray<FString>& /* ActiveSpeakers */,
+                                     const TArray<float>& /* AudioLevels */);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnMessageReceivedNativeDelegate, const FString& /* Message */,
+                                     const FDolbyIOParticipantInfo&);
+DECLARE_MULTICAST_DELEGATE(FDolbyIOOnTokenNeededNativeDelegate);
+DECLARE_MULTICAST_DELEGATE(FDolbyIOOnInitializedNativeDelegate);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnVideoTrackIDNativeDelegate, const FString& /* VideoTrackID */);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnScreenshareSourcesReceivedNativeDelegate,
+                                    const TArray<FDolbyIOScreenshareSource>&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnScreenshareSourceNativeDelegate, bool /* IsNone */,
+                                     const FDolbyIOScreenshareSource& /* OptionalSource */);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnAudioDevicesReceivedNativeDelegate, const TArray<FDolbyIOAudioDevice>&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnAudioDeviceNativeDelegate, bool /* IsNone */,
+                                     const FDolbyIOAudioDevice& /* OptionalDevice */);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnVideoDevicesReceivedNativeDelegate, const TArray<FDolbyIOVideoDevice>&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FDolbyIOOnVideoDeviceNativeDelegate, bool /* IsNone */,
+                                     const FDolbyIOVideoDevice& /* OptionalDevice */);
+DECLARE_MULTICAST_DELEGATE_OneParam(FDolbyIOOnErrorNativeDelegate, const FString& /* ErrorMsg */);
+
 namespace DolbyIO
 {
+	class FAudioLevels;
+	class FConnectionTimer;
 	class FDevices;
 	class FErrorHandler;
+	class FEventQueue;
+	class FFakeBackend;
+	class FLocationInterpolator;
+	class FSpatialCommandQueue;
 	class FVideoFrameHandler;
 	class FVideoSink;
+
+	using FIDHandle = uint32;
 }
 
+class UDolbyIOSpatialSourceComponent;
+
 UCLASS(DisplayName = "Dolby.io Subsystem")
-class DOLBYIO_API UDolbyIOSubsystem : public UGameInstanceSubsystem
+class DOLBYIO_API UDolbyIOSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
 	friend class DolbyIO::FErrorHandler;
+	friend class DolbyIO::FEventQueue;
+	friend class DolbyIO::FFakeBackend;
+	friend class UDolbyIOSpatialSourceComponent;
 
 public:
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
@@ -182,6 +256,19 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnErrorDelegate OnConnectError;
 
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	FDolbyIOConnectionTimings GetConnectionTimings() const;
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnConnectionTimingsDelegate OnConnectionTimings;
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void WarmUpConnection(const FString& ConferenceName = "", const FString& UserName = "",
+	                      const FString& ExternalID = "", const FString& AvatarURL = "",
+	                      EDolbyIOSpatialAudioStyle SpatialAudioStyle = EDolbyIOSpatialAudioStyle::Shared,
+	                      EDolbyIOVideoCodec VideoCodec = EDolbyIOVideoCodec::H264);
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnErrorDelegate OnWarmUpConnectionError;
+
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
 	void DemoConference();
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
@@ -194,6 +281,13 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnErrorDelegate OnDisconnectError;
 
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetAutomaticReconnect(bool bIsEnabled);
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnReconnectingDelegate OnReconnecting;
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnReconnectedDelegate OnReconnected;
+
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
 	void SetSpatialEnvironmentScale(float SpatialEnvironmentScale = 1.0f);
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
@@ -232,6 +326,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
 	TArray<FDolbyIOParticipantInfo> GetParticipants();
 
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	float GetAudioLevel(const FString& ParticipantID) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	float GetSmoothedAudioLevel(const FString& ParticipantID) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	float GetPeakAudioLevel(const FString& ParticipantID) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	bool IsParticipantSpeaking(const FString& ParticipantID, float MinDurationMs = 0.0f) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms", Meta = (AutoCreateRefTerm = "VideoDevice"))
 	void EnableVideo(const FDolbyIOVideoDevice& VideoDevice, bool bBlurBackground = false);
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
@@ -310,6 +416,12 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnErrorDelegate OnSetRemotePlayerLocationError;
 
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetRemotePlayerLocations(const TMap<FString, FVector>& Locations);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void AddRemotePlayerLocationSample(const FString& ParticipantID, const FVector& Location, const FVector& Velocity);
+
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
 	void SetLogSettings(EDolbyIOLogLevel SdkLogLevel = EDolbyIOLogLevel::Info,
 	                    EDolbyIOLogLevel MediaLogLevel = EDolbyIOLogLevel::Info,
@@ -412,38 +524,148 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnActiveSpeakersChangedDelegate OnActiveSpeakersChanged;
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnSpeakerStartedDelegate OnSpeakerStarted;
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnSpeakerStoppedDelegate OnSpeakerStopped;
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnAudioLevelsChangedDelegate OnAudioLevelsChanged;
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnMessageReceivedDelegate OnMessageReceived;
 
+	FDolbyIOOnConnectedNativeDelegate OnConnectedNative;
+	FDolbyIOOnDisconnectedNativeDelegate OnDisconnectedNative;
+	FDolbyIOOnConnectionTimingsNativeDelegate OnConnectionTimingsNative;
+	FDolbyIOOnReconnectingNativeDelegate OnReconnectingNative;
+	FDolbyIOOnReconnectedNativeDelegate OnReconnectedNative;
+	FDolbyIOOnParticipantStatusNativeDelegate OnParticipantAddedNative;
+	FDolbyIOOnParticipantStatusNativeDelegate OnParticipantUpdatedNative;
+	FDolbyIOOnParticipantNativeDelegate OnRemoteParticipantConnectedNative;
+	FDolbyIOOnParticipantNativeDelegate OnRemoteParticipantDisconnectedNative;
+	FDolbyIOOnParticipantStatusNativeDelegate OnLocalParticipantUpdatedNative;
+	FDolbyIOOnVideoTrackNativeDelegate OnVideoTrackAddedNative;
+	FDolbyIOOnVideoTrackNativeDelegate OnVideoTrackRemovedNative;
+	FDolbyIOOnVideoTrackNativeDelegate OnVideoTrackEnabledNative;
+	FDolbyIOOnVideoTrackNativeDelegate OnVideoTrackDisabledNative;
+	FDolbyIOOnActiveSpeakersChangedNativeDelegate OnActiveSpeakersChangedNative;
+	FDolbyIOOnSpeakerNativeDelegate OnSpeakerStartedNative;
+	FDolbyIOOnSpeakerNativeDelegate OnSpeakerStoppedNative;
+	FDolbyIOOnAudioLevelsChangedNativeDelegate OnAudioLevelsChangedNative;
+	FDolbyIOOnMessageReceivedNativeDelegate OnMessageReceivedNative;
+	FDolbyIOOnTokenNeededNativeDelegate OnTokenNeededNative;
+	FDolbyIOOnInitializedNativeDelegate OnInitializedNative;
+	FDolbyIOOnVideoTrackIDNativeDelegate OnVideoEnabledNative;
+	FDolbyIOOnVideoTrackIDNativeDelegate OnVideoDisabledNative;
+	FDolbyIOOnScreenshareSourcesReceivedNativeDelegate OnScreenshareSourcesReceivedNative;
+	FDolbyIOOnVideoTrackIDNativeDelegate OnScreenshareStartedNative;
+	FDolbyIOOnVideoTrackIDNativeDelegate OnScreenshareStoppedNative;
+	FDolbyIOOnScreenshareSourceNativeDelegate OnCurrentScreenshareSourceReceivedNative;
+	FDolbyIOOnAudioDevicesReceivedNativeDelegate OnAudioInputDevicesReceivedNative;
+	FDolbyIOOnAudioDevicesReceivedNativeDelegate OnAudioOutputDevicesReceivedNative;
+	FDolbyIOOnAudioDeviceNativeDelegate OnCurrentAudioInputDeviceReceivedNative;
+	FDolbyIOOnAudioDeviceNativeDelegate OnCurrentAudioOutputDeviceReceivedNative;
+	FDolbyIOOnAudioDeviceNativeDelegate OnCurrentAudioInputDeviceChangedNative;
+	FDolbyIOOnAudioDeviceNativeDelegate OnCurrentAudioOutputDeviceChangedNative;
+	FDolbyIOOnVideoDevicesReceivedNativeDelegate OnVideoDevicesReceivedNative;
+	FDolbyIOOnVideoDeviceNativeDelegate OnCurrentVideoDeviceReceivedNative;
+
+	// Native counterparts of the error events, broadcast with the same message.
+	FDolbyIOOnErrorNativeDelegate OnSetTokenErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnConnectErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnWarmUpConnectionErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnDemoConferenceErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnDisconnectErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSetSpatialEnvironmentScaleErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnMuteInputErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnUnmuteInputErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnMuteOutputErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnUnmuteOutputErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnMuteParticipantErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnUnmuteParticipantErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnEnableVideoErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnDisableVideoErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnGetScreenshareSourcesErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnStartScreenshareErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnStopScreenshareErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnChangeScreenshareParametersErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnGetCurrentScreenshareSourceErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSetLocalPlayerLocationErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSetLocalPlayerRotationErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSetRemotePlayerLocationErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSetLogSettingsErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnGetAudioInputDevicesErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnGetAudioOutputDevicesErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnGetCurrentAudioInputDeviceErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnGetCurrentAudioOutputDeviceErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSetAudioInputDeviceErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSetAudioOutputDeviceErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnGetVideoDevicesErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnGetCurrentVideoDeviceErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnUpdateUserMetadataErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSetAudioCaptureModeErrorNative;
+	FDolbyIOOnErrorNativeDelegate OnSendMessageErrorNative;
+
 private:
 	void Initialize(FSubsystemCollectionBase&) override;
 	void Deinitialize() override;
 
+	void Tick(float DeltaTime) override;
+	bool IsTickable() const override;
+	bool IsTickableWhenPaused() const override;
+	TStatId GetStatId() const override;
+
 	bool CanConnect(const FDolbyIOOnErrorDelegate&) const;
 	bool IsConnected() const;
 	bool IsConnectedAsActive() const;
 	bool IsSpatialAudio() const;
 
 	void Initialize(const FString& Token);
+	void RegisterEventHandlers(double StartTime);
+	void FinishWarmUp();
+	void FailConnect(std::exception_ptr&& ExcPtr);
 	void UpdateStatus(dolbyio::comms::conference_status);
+	void CloseSession();
+	void StartReconnecting();
+	void ScheduleReconnect();
+	void StopReconnecting();
+	void FinishReconnecting();
+	void UpdateReconnect();
+	void ReportConnectionTimings();
 	void EmptyRemoteParticipants();
+	void RemoveUnconfirmedParticipants();
 	void SetSpatialEnvironment();
 	void ToggleInputMute();
 	void ToggleOutputMute();
 
 	void BroadcastRemoteParticipantConnectedIfNecessary(const FDolbyIOParticipantInfo& ParticipantInfo);
-	void BroadcastRemoteParticipantDisconnectedIfNecessary(const FDolbyIOParticipantInfo& ParticipantInfo);
+	void BroadcastParticipantUpdated(const FDolbyIOParticipantInfo& ParticipantInfo);
+
+	void BroadcastAudioLevels();
 
 	void BroadcastVideoTrackAdded(const FDolbyIOVideoTrack& VideoTrack);
 	void BroadcastVideoTrackEnabled(const FDolbyIOVideoTrack& VideoTrack);
-	void ProcessBufferedVideoTracks(const FString& ParticipantID);
+	void ProcessBufferedVideoTracks(DolbyIO::FIDHandle ParticipantID);
+	void RemoveParkedVideoTracks();
 	void WarnIfVideoTrackSuspicious(const FString& VideoTrackID);
+	void HandleVideoTrackEnabled(const FDolbyIOVideoTrack& VideoTrack);
+	void HandleVideoTrackDisabled(const FDolbyIOVideoTrack& VideoTrack);
 
-	void SetLocationUsingFirstPlayer();
+	void UpdateSpatialUsingFirstPlayer();
 	void SetLocalPlayerLocationImpl(const FVector& Location);
-	void SetRotationUsingFirstPlayer();
 	void SetLocalPlayerRotationImpl(const FRotator& Rotation);
+	void ForwardLocalPlayerLocation(const FVector& Location, DolbyIO::FIDHandle ParticipantID);
+	void ForwardLocalPlayerDirection(const FVector& Direction);
+	bool CanSetRemotePlayerLocations() const;
+	void FlushRemotePlayerLocations();
+	void InterpolateRemotePlayerLocations();
+	void CountSpatialUpdates(int Count);
+
+	void RegisterSpatialSource(UDolbyIOSpatialSourceComponent& Source);
+	void UnregisterSpatialSource(UDolbyIOSpatialSourceComponent& Source);
+	void UpdateSpatialSourceParticipant(UDolbyIOSpatialSourceComponent& Source);
+	void GatherSpatialSources();
+
+	void UpdateAudioCulling();
+	void SetParticipantCulled(DolbyIO::FIDHandle ParticipantID, bool bIsCulled);
 
 	void Handle(const dolbyio::comms::active_speaker_changed&);
 	void Handle(const dolbyio::comms::audio_device_changed&);
@@ -467,30 +689,93 @@ private:
 	FString ConferenceID;
 	EDolbyIOConnectionMode ConnectionMode;
 	EDolbyIOSpatialAudioStyle SpatialAudioStyle;
-	TMap<FString, TArray<FDolbyIOVideoTrack>> BufferedAddedVideoTracks;
-	TMap<FString, TArray<FDolbyIOVideoTrack>> BufferedEnabledVideoTracks;
-
-	TMap<FString, FDolbyIOParticipantInfo> RemoteParticipants;
-	FCriticalSection RemoteParticipantsLock;
-
-	TMap<FString, std::shared_ptr<DolbyIO::FVideoSink>> VideoSinks;
+	// Participant and track IDs are interned, see DolbyIO::FIDTable.
+	TMap<DolbyIO::FIDHandle, TArray<FDolbyIOVideoTrack>> BufferedAddedVideoTracks;
+	TMap<DolbyIO::FIDHandle, TArray<FDolbyIOVideoTrack>> BufferedEnabledVideoTracks;
+
+	TMap<DolbyIO::FIDHandle, FDolbyIOParticipantInfo> RemoteParticipants;
+	TArray<DolbyIO::FIDHandle> ActiveSpeakerIDs; // sorted
+	TArray<DolbyIO::FIDHandle> NewActiveSpeakerIDs;
+	// Participants known before the connection was lost who have not been added again since reconnecting
+	TSet<DolbyIO::FIDHandle> UnconfirmedParticipantIDs;
+	FCriticalSection RemoteParticipantsLock; // also guards the active speaker lists and unconfirmed participants
+
+	// Connection stages completed ahead of Connect by WarmUpConnection. The keys identify the user information the
+	// session was opened with and the options the conference was created with, and are empty when there is none.
+	FString OpenSessionKey;
+	FString WarmConferenceKey;
+	TSharedPtr<dolbyio::comms::conference_info> WarmConferenceInfo;
+	TFunction<void()> ConnectAfterWarmUp;
+	bool bIsWarmingUp = false;
+	FCriticalSection WarmUpLock;
+
+	// Automatic reconnect state, only accessed from the game thread unless atomic. ReconnectCommand repeats the last
+	// Connect call.
+	std::atomic<bool> bIsAutomaticReconnectEnabled{false};
+	std::atomic<bool> bIsDisconnectRequested{false};
+	std::atomic<bool> bIsReconnecting{false};
+	bool bIsAttemptingReconnect = false;
+	TFunction<void()> ReconnectCommand;
+	int ReconnectAttempt = 0;
+	double ReconnectStartTime = 0.0;
+	double NextReconnectTime = 0.0;
+	double ReconnectGraceExpiryTime = 0.0;
+
+	TMap<DolbyIO::FIDHandle, std::shared_ptr<DolbyIO::FVideoSink>> VideoSinks;
+	// Tracks removed while reconnecting whose sinks are kept for when they are added again
+	TMap<DolbyIO::FIDHandle, FDolbyIOVideoTrack> ParkedVideoTracks;
 	FCriticalSection VideoSinksLock;
 
 	std::shared_ptr<dolbyio::comms::plugin::video_processor> VideoProcessor;
 	std::shared_ptr<DolbyIO::FVideoFrameHandler> LocalCameraFrameHandler;
 	std::shared_ptr<DolbyIO::FVideoFrameHandler> LocalScreenshareFrameHandler;
 	TSharedPtr<DolbyIO::FDevices> Devices;
+	TSharedPtr<DolbyIO::FAudioLevels> AudioLevelTable;
+	TSharedPtr<DolbyIO::FLocationInterpolator> LocationInterpolator;
+	TSharedPtr<DolbyIO::FConnectionTimer> ConnectionTimer;
+	TSharedPtr<DolbyIO::FSpatialCommandQueue> SpatialCommandQueue;
 	TSharedPtr<dolbyio::comms::sdk> Sdk;
 	TSharedPtr<dolbyio::comms::refresh_token> RefreshTokenCb;
+	TSharedPtr<DolbyIO::FFakeBackend> FakeBackend;
 
 	float SpatialEnvironmentScale = 1.0f;
 
 	bool bIsInputMuted = false;
 	bool bIsOutputMuted = false;
 	bool bIsVideoEnabled = false;
-
-	FTimerHandle LocationTimerHandle;
-	FTimerHandle RotationTimerHandle;
+	bool bIsDeinitialized = false;
+
+	// Reused by every On Audio Levels Changed broadcast
+	TArray<FString> BroadcastActiveSpeakers;
+	TArray<float> BroadcastAudioLevelValues;
+	std::atomic<bool> bIsAudioLevelsBroadcastPending{false};
+
+	bool bIsLocationSetAutomatically = true;
+	bool bIsRotationSetAutomatically = true;
+	bool bWasConnectedAsActive = false;
+	FVector LastSentLocation = FVector::ZeroVector;
+	FRotator LastSentRotation = FRotator::ZeroRotator;
+	double LastLocationSendTime = 0.0;
+	double LastRotationSendTime = 0.0;
+	TMap<DolbyIO::FIDHandle, FVector> PendingRemoteLocations;
+	TMap<DolbyIO::FIDHandle, FVector> LastSentRemoteLocations;
+
+	// Registered spatial sources in parallel arrays so that the per-frame pass only walks contiguous memory. Sources
+	// unregister themselves in EndPlay, so the pointers are always valid.
+	TArray<UDolbyIOSpatialSourceComponent*> SpatialSources;
+	TArray<DolbyIO::FIDHandle> SpatialSourceIDs;
+	TArray<FVector> SpatialSourceLocations;
+	TArray<FVector> SpatialSourceSentLocations;
+	bool bSpatialSourcesNeedFullUpdate = true;
+
+	// Participants whose audio is stopped because they were muted using MuteParticipant or culled by distance. Audio
+	// is only played again when a participant is in neither set.
+	TSet<DolbyIO::FIDHandle> MutedParticipants;
+	TSet<DolbyIO::FIDHandle> CulledParticipants;
+	TArray<TPair<float, DolbyIO::FIDHandle>> CullingCandidates;
+	double LastCullingTime = 0.0;
+	int SpatialUpdateCount = 0;
+	double SpatialUpdateCountStartTime = 0.0;
 
 	static constexpr auto LocalCameraTrackID = "local-camera";
 	static constexpr auto LocalScreenshareTrackID = "local-screenshare";
@@ -509,6 +794,17 @@ public:
 		bWantsInitializeComponent = true;
 	}
 
+	/** If true, only the events which are bound when the observer is initialized are forwarded, which saves the cost
+	 * of broadcasting the other events to this observer. In that case, call the Update Event Bindings function after
+	 * binding or unbinding events on the observer at runtime. By default, all events are forwarded.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dolby.io Comms")
+	bool bForwardOnlyBoundEvents = false;
+
+	/** Updates which events this observer forwards if Forward Only Bound Events is enabled. */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void UpdateEventBindings();
+
 	/** Triggered when an initial or refreshed client access token
 	 * (https://docs.dolby.io/communications-apis/docs/overview-developer-tools#client-access-token) is needed, which
 	 * happens when the Dolby.io Subsystem is initialized or when a refresh token is requested. After receiving this
@@ -532,6 +828,14 @@ public:
 	/** Triggered when errors occur after calling the Connect function. */
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnErrorDelegate OnConnectError;
+	/** Triggered once the stages of a connection started by the Connect function are reached, or some time after
+	 * joining if some stages are not reached, e.g. when nobody else is in the conference.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnConnectionTimingsDelegate OnConnectionTimings;
+	/** Triggered when errors occur after calling the Warm Up Connection function. */
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnErrorDelegate OnWarmUpConnectionError;
 	/** Triggered when errors occur after calling the Demo Conference function. */
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnErrorDelegate OnDemoConferenceError;
@@ -545,6 +849,15 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnErrorDelegate OnDisconnectError;
 
+	/** Triggered when automatic reconnect is enabled and the client is about to try reconnecting after losing
+	 * connection to the conference.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnReconnectingDelegate OnReconnecting;
+	/** Triggered when the client is reconnected to the conference after losing connection. */
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnReconnectedDelegate OnReconnected;
+
 	/** Triggered when errors occur after calling the Set Spatial Environment function. */
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnErrorDelegate OnSetSpatialEnvironmentScaleError;
@@ -668,6 +981,14 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnActiveSpeakersChangedDelegate OnActiveSpeakersChanged;
 
+	/** Triggered when a participant starts speaking. */
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnSpeakerStartedDelegate OnSpeakerStarted;
+
+	/** Triggered when a participant stops speaking. */
+	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
+	FDolbyIOOnSpeakerStoppedDelegate OnSpeakerStopped;
+
 	/** Triggered roughly every 500ms. The event provides two arrays: an array of IDs of the current speakers and an
 	 * array of floating point numbers representing each participant's audio level. The order of Audio Levels
 	 * corresponds to the order of Active Speakers. A value of 0.0 represents silence and a value of 1.0 represents the
@@ -770,6 +1091,9 @@ public:
 
 private:
 	void InitializeComponent() override;
+	void UninitializeComponent() override;
+
+	void BindEvents(UDolbyIOSubsystem& DolbyIOSubsystem, bool bKeepBoundEvents);
 
 #define DLB_DEFINE_FORWARDER(Event, ...) \
 	{                                    \
@@ -788,6 +1112,11 @@ private:
 	UFUNCTION()
 	void FwdOnConnectError(const FString& ErrorMsg) DLB_DEFINE_FORWARDER(OnConnectError, ErrorMsg);
 	UFUNCTION()
+	void FwdOnConnectionTimings(const FDolbyIOConnectionTimings& ConnectionTimings)
+	    DLB_DEFINE_FORWARDER(OnConnectionTimings, ConnectionTimings);
+	UFUNCTION()
+	void FwdOnWarmUpConnectionError(const FString& ErrorMsg) DLB_DEFINE_FORWARDER(OnWarmUpConnectionError, ErrorMsg);
+	UFUNCTION()
 	void FwdOnDemoConferenceError(const FString& ErrorMsg) DLB_DEFINE_FORWARDER(OnDemoConferenceError, ErrorMsg);
 
 	UFUNCTION()
@@ -795,6 +1124,12 @@ private:
 	UFUNCTION()
 	void FwdOnDisconnectError(const FString& ErrorMsg) DLB_DEFINE_FORWARDER(OnDisconnectError, ErrorMsg);
 
+	UFUNCTION()
+	void FwdOnReconnecting(int Attempt, float DelaySeconds) DLB_DEFINE_FORWARDER(OnReconnecting, Attempt, DelaySeconds);
+	UFUNCTION()
+	void FwdOnReconnected(int Attempts, float DurationSeconds)
+	    DLB_DEFINE_FORWARDER(OnReconnected, Attempts, DurationSeconds);
+
 	UFUNCTION()
 	void FwdOnSetSpatialEnvironmentScaleError(const FString& ErrorMsg)
 	    DLB_DEFINE_FORWARDER(OnSetSpatialEnvironmentScaleError, ErrorMsg);
@@ -895,6 +1230,12 @@ private:
 	void FwdOnActiveSpeakersChanged(const TArray<FString>& ActiveSpeakers)
 	    DLB_DEFINE_FORWARDER(OnActiveSpeakersChanged, ActiveSpeakers);
 
+	UFUNCTION()
+	void FwdOnSpeakerStarted(const FString& ParticipantID) DLB_DEFINE_FORWARDER(OnSpeakerStarted, ParticipantID);
+
+	UFUNCTION()
+	void FwdOnSpeakerStopped(const FString& ParticipantID) DLB_DEFINE_FORWARDER(OnSpeakerStopped, ParticipantID);
+
 	UFUNCTION()
 	void FwdOnAudioLevelsChanged(const TArray<FString>& ActiveSpeakers, const TArray<float>& AudioLevels)
 	    DLB_DEFINE_FORWARDER(OnAudioLevelsChanged, ActiveSpeakers, AudioLevels);
@@ -986,3 +1327,30 @@ private:
 
 #undef DLB_DEFINE_FORWARDER
 };
+
+UCLASS(ClassGroup = "Dolby.io Comms",
+       Meta = (BlueprintSpawnableComponent, DisplayName = "Dolby.io Spatial Source",
+               ToolTip = "Component which automatically sets the location of a remote participant to the location of "
+                         "the owning actor."))
+class DOLBYIO_API UDolbyIOSpatialSourceComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** Sets the ID of the remote participant whose location should follow the owning actor.
+	 *
+	 * @param NewParticipantID - The ID of the remote participant.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetParticipantID(const FString& NewParticipantID);
+
+	/** The ID of the remote participant whose location follows the owning actor. The location is only set while
+	 * connected in individual spatial audio style and only when the actor moves noticeably.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dolby.io Comms")
+	FString ParticipantID;
+
+private:
+	void BeginPlay() override;
+	void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
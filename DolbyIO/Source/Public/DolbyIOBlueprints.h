@@ -833,6 +833,29 @@ class UDolbyIOBlueprintFunctionLibrary : public UBlueprintFunctionLibrary
 	return DolbyIOSubsystem->MethodName(__VA_ARGS__);
 
 public:
+	/** Prepares a connection ahead of time, for example during a loading screen, so that a later Connect with the same
+	 * arguments only needs to join the conference. Opens a session and, if a conference name is given, creates the
+	 * conference. Connect waits for the warm-up to finish if it is still in progress.
+	 *
+	 * @param ConferenceName - The conference name. If empty, only the session is opened.
+	 * @param UserName - The name of the participant.
+	 * @param ExternalID - The external unique identifier of the participant.
+	 * @param AvatarURL - The URL of the participant's avatar.
+	 * @param SpatialAudioStyle - The spatial audio style of the conference.
+	 * @param VideoCodec - The preferred video codec.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Warm Up Connection"))
+	static void WarmUpConnection(const UObject* WorldContextObject, const FString& ConferenceName = "",
+	                             const FString& UserName = "", const FString& ExternalID = "",
+	                             const FString& AvatarURL = "",
+	                             EDolbyIOSpatialAudioStyle SpatialAudioStyle = EDolbyIOSpatialAudioStyle::Shared,
+	                             EDolbyIOVideoCodec VideoCodec = EDolbyIOVideoCodec::H264)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(WarmUpConnection, ConferenceName, UserName, ExternalID, AvatarURL,
+		                             SpatialAudioStyle, VideoCodec);
+	}
+
 	/** Sets the spatial environment scale.
 	 *
 	 * The larger the scale, the longer the distance at which the spatial audio
@@ -914,6 +937,20 @@ public:
 		DLB_EXECUTE_SUBSYSTEM_METHOD(UnmuteParticipant, ParticipantID);
 	}
 
+	/** Enables or disables reconnecting automatically after the connection to the conference is lost.
+	 *
+	 * While reconnecting, the plugin retries the last Connect call with an exponential backoff and keeps the textures
+	 * of remote video tracks so that bound materials keep showing the last frame.
+	 *
+	 * @param bIsEnabled - Whether to reconnect automatically.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Set Automatic Reconnect"))
+	static void SetAutomaticReconnect(const UObject* WorldContextObject, bool bIsEnabled)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetAutomaticReconnect, bIsEnabled);
+	}
+
 	/** Gets a list of all remote participants.
 	 *
 	 * @return An array of current Dolby.io Participant Info's.
@@ -925,6 +962,71 @@ public:
 		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(GetParticipants);
 	}
 
+	/** Gets the times at which the stages of the latest connection were reached.
+	 *
+	 * @return The timings in milliseconds since connecting started, -1 for stages which were not reached.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Get Connection Timings"))
+	static FDolbyIOConnectionTimings GetConnectionTimings(const UObject* WorldContextObject)
+	{
+		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(GetConnectionTimings);
+	}
+
+	/** Gets the latest audio level of a given participant without waiting for the On Audio Levels Changed event.
+	 * Suitable for calling every frame.
+	 *
+	 * @param ParticipantID - The ID of the participant.
+	 * @return The audio level between 0.0 (silence) and 1.0 (maximum volume), or 0.0 if the level is not known.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Get Audio Level"))
+	static float GetAudioLevel(const UObject* WorldContextObject, const FString& ParticipantID)
+	{
+		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(GetAudioLevel, ParticipantID);
+	}
+
+	/** Gets the audio level of a given participant smoothed over the recent history of levels. The length of the
+	 * history is controlled by the DolbyIO.AudioLevels.SmoothingWindowMs console variable.
+	 *
+	 * @param ParticipantID - The ID of the participant.
+	 * @return The root mean square of the recent audio levels, or 0.0 if the levels are not known.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Get Smoothed Audio Level"))
+	static float GetSmoothedAudioLevel(const UObject* WorldContextObject, const FString& ParticipantID)
+	{
+		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(GetSmoothedAudioLevel, ParticipantID);
+	}
+
+	/** Gets the highest recent audio level of a given participant. The peak is held for the duration controlled by
+	 * the DolbyIO.AudioLevels.PeakHoldMs console variable.
+	 *
+	 * @param ParticipantID - The ID of the participant.
+	 * @return The peak audio level, or 0.0 if the levels are not known.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Get Peak Audio Level"))
+	static float GetPeakAudioLevel(const UObject* WorldContextObject, const FString& ParticipantID)
+	{
+		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(GetPeakAudioLevel, ParticipantID);
+	}
+
+	/** Checks whether a given participant's audio level has stayed at or above the
+	 * DolbyIO.AudioLevels.SpeakingThreshold console variable for a minimum duration.
+	 *
+	 * @param ParticipantID - The ID of the participant.
+	 * @param MinDurationMs - The minimum duration in milliseconds.
+	 * @return Whether the participant has been speaking for at least the minimum duration.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Is Participant Speaking"))
+	static bool IsParticipantSpeaking(const UObject* WorldContextObject, const FString& ParticipantID,
+	                                  float MinDurationMs = 0.0f)
+	{
+		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(IsParticipantSpeaking, ParticipantID, MinDurationMs);
+	}
+
 	/** Binds a dynamic material instance to hold the frames of the given video track. The plugin will update the
 	 * material's texture parameter named "DolbyIO Frame" with the necessary data, therefore the material should
 	 * have such a parameter to be usable. Automatically unbinds the material from all other tracks, but it is
@@ -1032,6 +1134,41 @@ public:
 		DLB_EXECUTE_SUBSYSTEM_METHOD(SetRemotePlayerLocation, ParticipantID, Location);
 	}
 
+	/** Updates the locations of many remote participants at once for spatial audio purposes. This is cheaper than
+	 * calling Set Remote Player Location for each participant.
+	 *
+	 * This is only applicable when the spatial audio style of the conference is set to "Individual".
+	 *
+	 * The location of the local participant is ignored. Use Set Local Player Location instead.
+	 *
+	 * @param Locations - The locations of the remote participants, keyed by participant ID.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Set Remote Player Locations"))
+	static void SetRemotePlayerLocations(const UObject* WorldContextObject, const TMap<FString, FVector>& Locations)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetRemotePlayerLocations, Locations);
+	}
+
+	/** Adds a sample of the location and velocity of a remote participant for spatial audio purposes. Samples can be
+	 * added at a much lower rate than locations are set, because the plugin interpolates between them every frame.
+	 *
+	 * This is only applicable when the spatial audio style of the conference is set to "Individual".
+	 *
+	 * Calling this function with the local participant ID has no effect.
+	 *
+	 * @param ParticipantID - The ID of the remote participant.
+	 * @param Location - The location of the remote participant.
+	 * @param Velocity - The velocity of the remote participant.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Add Remote Player Location Sample"))
+	static void AddRemotePlayerLocationSample(const UObject* WorldContextObject, const FString& ParticipantID,
+	                                          const FVector& Location, const FVector& Velocity)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(AddRemotePlayerLocationSample, ParticipantID, Location, Velocity);
+	}
+
 	/** Sets what to log in the Dolby.io C++ SDK.
 	 *
 	 * This function should be called before the first call to Set Token if the user needs logs about the plugin's
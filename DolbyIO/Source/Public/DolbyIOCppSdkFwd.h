@@ -5,6 +5,7 @@
 namespace dolbyio::comms
 {
 	enum class conference_status;
+	struct conference_info;
 	class refresh_token;
 	class sdk;
 
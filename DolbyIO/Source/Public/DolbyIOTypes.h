@@ -264,6 +264,39 @@ struct DOLBYIO_API FDolbyIOVideoTrack
 	bool bIsScreenshare{};
 };
 
+/** Contains the times at which the stages of the latest connection were reached, in milliseconds since connecting
+ * started. Stages which were not reached are -1. Stages completed ahead of time by Warm Up Connection are 0.
+ */
+USTRUCT(BlueprintType, DisplayName = "Dolby.io Connection Timings")
+struct DOLBYIO_API FDolbyIOConnectionTimings
+{
+	GENERATED_BODY()
+
+	/** The session is open. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float SessionOpenMs = -1.0f;
+
+	/** The conference is created. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float ConferenceCreateMs = -1.0f;
+
+	/** The conference is joined or listened to. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float JoinMs = -1.0f;
+
+	/** The first remote participant is added. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float FirstRemoteParticipantMs = -1.0f;
+
+	/** The first frame of a remote video track is received. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float FirstRemoteVideoFrameMs = -1.0f;
+
+	/** The first audio levels are received. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float FirstAudioLevelMs = -1.0f;
+};
+
 /** The level of logs of the Dolby.io C++ SDK. */
 UENUM(BlueprintType, DisplayName = "Dolby.io Log Level")
 enum class EDolbyIOLogLevel : uint8